@@ -0,0 +1,111 @@
+package main
+
+/*
+#cgo CFLAGS: -I${SRCDIR}/duckdb-go-api -DDUCKDB_API_EXCLUDE_FUNCTIONS=1
+#include <stdlib.h>
+#include <duckdb.h>
+#include <duckdb_go_extension.h>
+
+void duckarrow_aggregate_bind_wrapper(duckdb_bind_info info);
+*/
+import "C"
+import (
+	"duckdb"
+	"fmt"
+	"runtime"
+	"strings"
+	"unsafe"
+)
+
+// duckarrow_aggregate_bind_wrapper binds duckarrow_aggregate(table, aggregates),
+// which groups a remote table on the server so only the grouped result is
+// transferred. The DuckDB C API has no optimizer hook to rewrite GROUP BY over
+// duckarrow.* scans, so the aggregation is requested explicitly.
+//
+// Usage in SQL:
+//
+//	-- Instead of SELECT status, COUNT(*), SUM(total) FROM duckarrow."Orders" GROUP BY status
+//	SELECT * FROM duckarrow_aggregate('Orders', 'count(*), sum(total)', group_by := 'status');
+//
+//	-- Qualified tables and a filter evaluated on the server
+//	SELECT * FROM duckarrow_aggregate('sales.Orders', 'avg(total)',
+//	    group_by := 'region, status', filter := 'total > 100');
+//
+//export duckarrow_aggregate_bind_wrapper
+func duckarrow_aggregate_bind_wrapper(info C.duckdb_bind_info) {
+	runtime.LockOSThread()
+	defer runtime.UnlockOSThread()
+
+	uri := GetDuckArrowURI()
+	if uri == "" {
+		duckdb.SetBindError(duckdb.BindInfo{Ptr: unsafe.Pointer(info)}, "not configured - call duckarrow_configure() first")
+		return
+	}
+
+	query, err := aggregateQuery(
+		bindVarcharParameter(info, 0),
+		bindVarcharParameter(info, 1),
+		bindNamedVarcharParameter(info, "group_by"),
+		bindNamedVarcharParameter(info, "filter"),
+	)
+	if err != nil {
+		duckdb.SetBindError(duckdb.BindInfo{Ptr: unsafe.Pointer(info)}, "%v", err)
+		return
+	}
+	// The grouped query is a plain SELECT, so it is planned at bind and any
+	// projection of its columns is pushed down as well
+	bindRemote(info, "duckarrow_aggregate", uri, query, TableRef{})
+}
+
+// aggregateQuery validates duckarrow_aggregate's arguments and builds the
+// query the server runs.
+func aggregateQuery(tableName, aggregates, groupBy, filter string) (string, error) {
+	table, err := parseTableName(tableName)
+	if err == nil {
+		err = validateTableRef(table)
+	}
+	if err != nil {
+		return "", err
+	}
+	aggs, err := parseAggregates(aggregates)
+	if err != nil {
+		return "", err
+	}
+	groups, err := parseColumnList(groupBy)
+	if err != nil {
+		return "", fmt.Errorf("group_by: %w", err)
+	}
+	// The filter is sent as written; keep it to one statement without comments
+	for _, pattern := range []string{";", "--", "/*", "*/", "\x00"} {
+		if strings.Contains(filter, pattern) {
+			return "", fmt.Errorf("filter contains invalid characters")
+		}
+	}
+	return buildAggregateQuery(table, groups, aggs, filter), nil
+}
+
+// bindNamedVarcharParameter returns the named parameter as a string, "" if not given.
+func bindNamedVarcharParameter(info C.duckdb_bind_info, name string) string {
+	cName := C.CString(name)
+	defer C.free(unsafe.Pointer(cName))
+	val := C.duckdb_bind_get_named_parameter(info, cName)
+	if val == nil {
+		return ""
+	}
+	defer C.duckdb_destroy_value(&val)
+	if C.duckdb_is_null_value(val) {
+		return ""
+	}
+	cStr := C.duckdb_get_varchar(val)
+	defer C.duckdb_free(unsafe.Pointer(cStr))
+	return C.GoString(cStr)
+}
+
+// RegisterDuckArrowAggregateFunction registers duckarrow_aggregate().
+//
+// Returns:
+//   - duckdb.STATE_OK on success, duckdb.STATE_ERROR on failure
+func RegisterDuckArrowAggregateFunction(conn duckdb.Connection) duckdb.State {
+	return registerScanFunction(conn, "duckarrow_aggregate", 2, []string{"group_by", "filter"},
+		C.duckdb_table_function_bind_t(C.duckarrow_aggregate_bind_wrapper))
+}
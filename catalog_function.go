@@ -0,0 +1,134 @@
+package main
+
+/*
+#cgo CFLAGS: -I${SRCDIR}/duckdb-go-api -DDUCKDB_API_EXCLUDE_FUNCTIONS=1
+#include <duckdb.h>
+#include <duckdb_go_extension.h>
+*/
+import "C"
+import (
+	"context"
+	"duckdb"
+	"fmt"
+	"strconv"
+
+	"main/internal/flight"
+)
+
+// The DuckDB C API has no hook for a custom catalog, so remote tables cannot
+// be listed in information_schema. duckarrow_tables() and duckarrow_columns()
+// list them instead, from the server's GetObjects metadata. Listings are
+// cached per server for catalog_ttl_seconds; a stale listing is served while
+// a background refresh replaces it.
+
+// duckarrowTablesFunction lists the remote tables.
+//
+// Usage in SQL:
+//
+//	SELECT * FROM duckarrow_tables();
+//	SELECT * FROM duckarrow_tables(refresh := true);  -- skip the cache
+var duckarrowTablesFunction = &rowsFunction{
+	Name:  "duckarrow_tables",
+	Named: []string{"refresh"},
+	Columns: []rowsColumn{
+		{"table_catalog", C.DUCKDB_TYPE_VARCHAR},
+		{"table_schema", C.DUCKDB_TYPE_VARCHAR},
+		{"table_name", C.DUCKDB_TYPE_VARCHAR},
+		{"table_type", C.DUCKDB_TYPE_VARCHAR},
+		{"column_count", C.DUCKDB_TYPE_BIGINT},
+	},
+	Rows: func(args []string) ([][]any, error) {
+		tables, err := remoteTables(args[0])
+		if err != nil {
+			return nil, err
+		}
+		rows := make([][]any, len(tables))
+		for i, t := range tables {
+			rows[i] = []any{emptyAsNull(t.Catalog), emptyAsNull(t.Schema), t.Name, t.Type, int64(len(t.Columns))}
+		}
+		return rows, nil
+	},
+}
+
+// duckarrowColumnsFunction lists the columns of every remote table.
+//
+// Usage in SQL:
+//
+//	SELECT column_name, data_type FROM duckarrow_columns() WHERE table_name = 'Orders';
+var duckarrowColumnsFunction = &rowsFunction{
+	Name:  "duckarrow_columns",
+	Named: []string{"refresh"},
+	Columns: []rowsColumn{
+		{"table_catalog", C.DUCKDB_TYPE_VARCHAR},
+		{"table_schema", C.DUCKDB_TYPE_VARCHAR},
+		{"table_name", C.DUCKDB_TYPE_VARCHAR},
+		{"column_name", C.DUCKDB_TYPE_VARCHAR},
+		{"ordinal_position", C.DUCKDB_TYPE_BIGINT},
+		{"data_type", C.DUCKDB_TYPE_VARCHAR},
+		{"is_nullable", C.DUCKDB_TYPE_BOOLEAN},
+	},
+	Rows: func(args []string) ([][]any, error) {
+		tables, err := remoteTables(args[0])
+		if err != nil {
+			return nil, err
+		}
+		var rows [][]any
+		for _, t := range tables {
+			for _, col := range t.Columns {
+				var nullable any
+				if col.Nullable != nil {
+					nullable = *col.Nullable
+				}
+				rows = append(rows, []any{
+					emptyAsNull(t.Catalog),
+					emptyAsNull(t.Schema),
+					t.Name,
+					col.Name,
+					int64(col.Position),
+					emptyAsNull(col.TypeName),
+					nullable,
+				})
+			}
+		}
+		return rows, nil
+	},
+}
+
+// remoteTables returns the configured server's tables, from the catalog
+// cache unless refresh is true.
+func remoteTables(refresh string) ([]flight.TableInfo, error) {
+	uri, username, password, skipVerify := GetDuckArrowConfig()
+	if uri == "" {
+		return nil, fmt.Errorf("not configured - call duckarrow_configure() first")
+	}
+	if refresh != "" {
+		forceRefresh, err := strconv.ParseBool(refresh)
+		if err != nil {
+			return nil, fmt.Errorf("refresh: expected a boolean, got %q", refresh)
+		}
+		if forceRefresh {
+			flight.Catalog.Invalidate()
+		}
+	}
+	cfg := flight.Config{URI: uri, Username: username, Password: password, SkipVerify: skipVerify}
+	return flight.Catalog.Tables(context.Background(), cfg)
+}
+
+// emptyAsNull returns nil for "", for servers that leave a name out.
+func emptyAsNull(s string) any {
+	if s == "" {
+		return nil
+	}
+	return s
+}
+
+// RegisterDuckArrowCatalogFunctions registers duckarrow_tables() and duckarrow_columns().
+//
+// Returns:
+//   - duckdb.STATE_OK on success, duckdb.STATE_ERROR on failure
+func RegisterDuckArrowCatalogFunctions(conn duckdb.Connection) duckdb.State {
+	if state := registerRowsFunction(conn, duckarrowTablesFunction); state == duckdb.STATE_ERROR {
+		return state
+	}
+	return registerRowsFunction(conn, duckarrowColumnsFunction)
+}
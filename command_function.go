@@ -0,0 +1,129 @@
+package main
+
+/*
+#cgo CFLAGS: -I${SRCDIR}/duckdb-go-api -DDUCKDB_API_EXCLUDE_FUNCTIONS=1
+#include <stdlib.h>
+#include <duckdb.h>
+#include <duckdb_go_extension.h>
+
+// Forward declarations of Go callbacks
+void duckarrow_command_callback(duckdb_function_info info, duckdb_data_chunk input, duckdb_vector output);
+void duckarrow_command_destroy(void *data);
+*/
+import "C"
+import (
+	"duckdb"
+	"runtime"
+	"runtime/cgo"
+	"unsafe"
+)
+
+// commandFunction is a volatile scalar function taking VARCHAR arguments and
+// returning a VARCHAR status message. It backs the operational functions
+// (profiling, settings) that act on extension state rather than on rows.
+//
+// Call runs once per input row. If any argument is NULL the result is NULL
+// and Call is not invoked.
+type commandFunction struct {
+	Name   string
+	Params int // Number of VARCHAR parameters passed to Call
+	Call   func(args []string) (string, error)
+}
+
+//export duckarrow_command_callback
+func duckarrow_command_callback(info C.duckdb_function_info, input C.duckdb_data_chunk, output C.duckdb_vector) {
+	runtime.LockOSThread()
+	defer runtime.UnlockOSThread()
+
+	fn, ok := cgo.Handle(uintptr(C.duckdb_scalar_function_get_extra_info(info))).Value().(*commandFunction)
+	if !ok {
+		setCommandError(info, "duckarrow", "internal error: invalid command function")
+		return
+	}
+
+	inputSize := C.duckdb_data_chunk_get_size(input)
+	if inputSize > maxDuckDBChunkSize {
+		setCommandError(info, fn.Name, "input chunk size exceeds maximum")
+		return
+	}
+
+	vecs := make([]C.duckdb_vector, fn.Params)
+	for p := range vecs {
+		vecs[p] = C.duckdb_data_chunk_get_vector(input, C.idx_t(p))
+		if vecs[p] == nil {
+			setCommandError(info, fn.Name, "failed to get input vector")
+			return
+		}
+	}
+
+	args := make([]string, fn.Params)
+rows:
+	for i := C.idx_t(0); i < inputSize; i++ {
+		for p, vec := range vecs {
+			validity := C.duckdb_vector_get_validity(vec)
+			if !rowIsValid(validity, uint64(i), uint64(inputSize)) {
+				C.duckdb_vector_ensure_validity_writable(output)
+				setRowInvalid(C.duckdb_vector_get_validity(output), uint64(i), uint64(inputSize))
+				continue rows
+			}
+			arg, err := extractString(C.duckdb_vector_get_data(vec), i)
+			if err != nil {
+				setCommandError(info, fn.Name, "failed to read argument: "+err.Error())
+				return
+			}
+			args[p] = arg
+		}
+
+		result, err := fn.Call(args)
+		if err != nil {
+			setCommandError(info, fn.Name, err.Error())
+			return
+		}
+		duckdb.AssignStringToVector(duckdb.Vector{Ptr: unsafe.Pointer(output)}, int(i), result)
+	}
+}
+
+//export duckarrow_command_destroy
+func duckarrow_command_destroy(data unsafe.Pointer) {
+	if data == nil {
+		return
+	}
+	cgo.Handle(uintptr(data)).Delete()
+}
+
+// setCommandError sets a scalar function error prefixed with the function name.
+func setCommandError(info C.duckdb_function_info, name, msg string) {
+	errMsg := C.CString(name + ": " + msg)
+	C.duckdb_scalar_function_set_error(info, errMsg)
+	C.free(unsafe.Pointer(errMsg))
+}
+
+// registerCommandFunction registers fn as a DuckDB scalar function. It is
+// marked volatile so DuckDB never constant-folds it and runs it on every call.
+func registerCommandFunction(conn duckdb.Connection, fn *commandFunction) duckdb.State {
+	scalarFunc := C.duckdb_create_scalar_function()
+	defer C.duckdb_destroy_scalar_function(&scalarFunc)
+
+	name := C.CString(fn.Name)
+	defer C.free(unsafe.Pointer(name))
+	C.duckdb_scalar_function_set_name(scalarFunc, name)
+
+	varcharType := C.duckdb_create_logical_type(C.DUCKDB_TYPE_VARCHAR)
+	for i := 0; i < fn.Params; i++ {
+		C.duckdb_scalar_function_add_parameter(scalarFunc, varcharType)
+	}
+	C.duckdb_scalar_function_set_return_type(scalarFunc, varcharType)
+	C.duckdb_destroy_logical_type(&varcharType)
+
+	C.duckdb_scalar_function_set_volatile(scalarFunc)
+
+	handle := cgo.NewHandle(fn)
+	C.duckdb_scalar_function_set_extra_info(scalarFunc, unsafe.Pointer(handle),
+		C.duckdb_delete_callback_t(C.duckarrow_command_destroy))
+
+	C.duckdb_scalar_function_set_function(scalarFunc,
+		C.duckdb_scalar_function_t(C.duckarrow_command_callback))
+
+	return duckdb.State(C.duckdb_register_scalar_function(
+		C.duckdb_connection(conn.Ptr), scalarFunc))
+}
@@ -0,0 +1,161 @@
+package main
+
+/*
+#cgo CFLAGS: -I${SRCDIR}/duckdb-go-api -DDUCKDB_API_EXCLUDE_FUNCTIONS=1
+#include <stdlib.h>
+#include <duckdb.h>
+#include <duckdb_go_extension.h>
+
+// Store a column of Arrow string or binary values in one cgo call. Rows already
+// marked invalid are skipped; their offsets are still read.
+static void duckarrow_assign_strings32(duckdb_vector vec, const char *data, const int32_t *offsets, idx_t count) {
+	uint64_t *validity = duckdb_vector_get_validity(vec);
+	for (idx_t i = 0; i < count; i++) {
+		if (validity && !duckdb_validity_row_is_valid(validity, i)) {
+			continue;
+		}
+		idx_t len = (idx_t)(offsets[i + 1] - offsets[i]);
+		duckdb_vector_assign_string_element_len(vec, i, len ? data + offsets[i] : "", len);
+	}
+}
+
+static void duckarrow_assign_strings_at(duckdb_vector vec, const int32_t *rows, const char *data, const int32_t *offsets, idx_t count) {
+	for (idx_t i = 0; i < count; i++) {
+		duckdb_vector_assign_string_element_len(vec, (idx_t)rows[i], data + offsets[i], (idx_t)(offsets[i + 1] - offsets[i]));
+	}
+}
+
+static void duckarrow_assign_strings64(duckdb_vector vec, const char *data, const int64_t *offsets, idx_t count) {
+	uint64_t *validity = duckdb_vector_get_validity(vec);
+	for (idx_t i = 0; i < count; i++) {
+		if (validity && !duckdb_validity_row_is_valid(validity, i)) {
+			continue;
+		}
+		idx_t len = (idx_t)(offsets[i + 1] - offsets[i]);
+		duckdb_vector_assign_string_element_len(vec, i, len ? data + offsets[i] : "", len);
+	}
+}
+*/
+import "C"
+import (
+	"duckdb"
+	"unsafe"
+
+	"main/internal/convert"
+)
+
+// duckVector adapts a duckdb_vector to the convert.Vector interface used by the
+// Arrow to DuckDB conversion kernels. Validity is written directly into DuckDB's
+// mask and string columns go through one C call, so the number of cgo
+// crossings per chunk does not grow with the row count.
+//
+// Child vectors are looked up once and kept: DuckDB resets a chunk's nested
+// vectors in place between chunks, so a scan reuses one tree of child
+// handles per column (see reuse) instead of fetching each level per chunk.
+type duckVector struct {
+	vec      C.duckdb_vector
+	validity *C.uint64_t   // Writable validity mask, fetched on first use
+	children []*duckVector // STRUCT/UNION children, or the LIST/ARRAY child at 0
+}
+
+// newDuckVector wraps a DuckDB vector for conversion.
+func newDuckVector(vec duckdb.Vector) *duckVector {
+	return &duckVector{vec: C.duckdb_vector(vec.Ptr)}
+}
+
+// reuse prepares a vector kept from the previous chunk for vec, returning nil
+// if vec is a different vector. Child handles are kept; validity masks are
+// per chunk and fetched again.
+func (v *duckVector) reuse(vec duckdb.Vector) *duckVector {
+	if v == nil || v.vec != C.duckdb_vector(vec.Ptr) {
+		return nil
+	}
+	v.reset()
+	return v
+}
+
+// reset drops the cached validity masks of v and its descendants.
+func (v *duckVector) reset() {
+	v.validity = nil
+	for _, child := range v.children {
+		if child != nil {
+			child.reset()
+		}
+	}
+}
+
+// child returns the cached child at idx, fetching it with get on first use.
+func (v *duckVector) child(idx int, get func() C.duckdb_vector) *duckVector {
+	if idx >= len(v.children) {
+		v.children = append(v.children, make([]*duckVector, idx+1-len(v.children))...)
+	}
+	if v.children[idx] == nil {
+		v.children[idx] = &duckVector{vec: get()}
+	}
+	return v.children[idx]
+}
+
+func (v *duckVector) Data() unsafe.Pointer {
+	return C.duckdb_vector_get_data(v.vec)
+}
+
+func (v *duckVector) ValidityMask(count int) []uint64 {
+	if v.validity == nil {
+		// The validity mask is allocated lazily, so fetch it only once a NULL is seen
+		C.duckdb_vector_ensure_validity_writable(v.vec)
+		v.validity = C.duckdb_vector_get_validity(v.vec)
+	}
+	return unsafe.Slice((*uint64)(unsafe.Pointer(v.validity)), (count+63)/64)
+}
+
+func (v *duckVector) AssignString(row int, s string) {
+	duckdb.AssignStringToVector(duckdb.Vector{Ptr: unsafe.Pointer(v.vec)}, row, s)
+}
+
+func (v *duckVector) AssignStrings32(data []byte, offsets []int32) {
+	if len(offsets) < 2 {
+		return
+	}
+	C.duckarrow_assign_strings32(v.vec, (*C.char)(unsafe.Pointer(unsafe.SliceData(data))),
+		(*C.int32_t)(unsafe.Pointer(&offsets[0])), C.idx_t(len(offsets)-1))
+}
+
+func (v *duckVector) AssignStrings64(data []byte, offsets []int64) {
+	if len(offsets) < 2 {
+		return
+	}
+	C.duckarrow_assign_strings64(v.vec, (*C.char)(unsafe.Pointer(unsafe.SliceData(data))),
+		(*C.int64_t)(unsafe.Pointer(&offsets[0])), C.idx_t(len(offsets)-1))
+}
+
+func (v *duckVector) AssignStringsAt(rows []int32, data []byte, offsets []int32) {
+	if len(rows) == 0 {
+		return
+	}
+	C.duckarrow_assign_strings_at(v.vec, (*C.int32_t)(unsafe.Pointer(&rows[0])),
+		(*C.char)(unsafe.Pointer(unsafe.SliceData(data))), (*C.int32_t)(unsafe.Pointer(&offsets[0])), C.idx_t(len(rows)))
+}
+
+func (v *duckVector) StructChild(idx int) convert.Vector {
+	return v.child(idx, func() C.duckdb_vector { return C.duckdb_struct_vector_get_child(v.vec, C.idx_t(idx)) })
+}
+
+func (v *duckVector) ListChild() convert.Vector {
+	return v.child(0, func() C.duckdb_vector { return C.duckdb_list_vector_get_child(v.vec) })
+}
+
+func (v *duckVector) ListReserve(capacity uint64) {
+	C.duckdb_list_vector_reserve(v.vec, C.idx_t(capacity))
+	// Growing the child reallocates its buffers, validity masks included
+	if len(v.children) > 0 && v.children[0] != nil {
+		v.children[0].reset()
+	}
+}
+
+func (v *duckVector) ListSetSize(size uint64) {
+	C.duckdb_list_vector_set_size(v.vec, C.idx_t(size))
+}
+
+func (v *duckVector) ArrayChild() convert.Vector {
+	return v.child(0, func() C.duckdb_vector { return C.duckdb_array_vector_get_child(v.vec) })
+}
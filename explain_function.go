@@ -0,0 +1,212 @@
+package main
+
+/*
+#cgo CFLAGS: -I${SRCDIR}/duckdb-go-api -DDUCKDB_API_EXCLUDE_FUNCTIONS=1
+#include <stdlib.h>
+#include <duckdb.h>
+#include <duckdb_go_extension.h>
+*/
+import "C"
+import (
+	"context"
+	"duckdb"
+	"fmt"
+	"strconv"
+	"strings"
+	"unsafe"
+
+	"github.com/apache/arrow-go/v18/arrow"
+
+	"main/internal/flight"
+	"main/internal/stats"
+)
+
+// duckarrowExplainFunction runs a query and reports, for every remote scan it
+// made, exactly what was pushed to the Flight SQL server. Like EXPLAIN ANALYZE,
+// the query is executed in full; its result is discarded.
+//
+// Filters are never pushed down (the DuckDB C API does not expose them to
+// table functions), so pushed_filters is always NULL and DuckDB applies every
+// filter locally. remote_schema comes from GetSchema, which does not run the
+// pushed query again; the partition plan (GetFlightInfo, which some servers
+// answer by executing the query) is only fetched with partitions := true.
+//
+// Usage in SQL:
+//
+//	SELECT remote_sql, pushed_columns, remote_schema, rows, bytes
+//	FROM duckarrow_explain('SELECT id FROM duckarrow."Orders" WHERE total > 100');
+//
+//	-- Include the partition plan and the server's own plan (runs EXPLAIN on the server)
+//	SELECT endpoints, estimated_rows, remote_plan
+//	FROM duckarrow_explain('SELECT * FROM duckarrow."Orders"', partitions := true, remote_plan := true);
+var duckarrowExplainFunction = &rowsFunction{
+	Name:   "duckarrow_explain",
+	Params: 1,
+	Named:  []string{"remote_plan", "partitions"},
+	Columns: []rowsColumn{
+		{"scan_id", C.DUCKDB_TYPE_BIGINT},
+		{"uri", C.DUCKDB_TYPE_VARCHAR},
+		{"remote_sql", C.DUCKDB_TYPE_VARCHAR},
+		{"pushed_columns", C.DUCKDB_TYPE_VARCHAR},
+		{"pushed_filters", C.DUCKDB_TYPE_VARCHAR},
+		{"remote_schema", C.DUCKDB_TYPE_VARCHAR},
+		{"endpoints", C.DUCKDB_TYPE_BIGINT},
+		{"estimated_rows", C.DUCKDB_TYPE_BIGINT},
+		{"rows", C.DUCKDB_TYPE_BIGINT},
+		{"bytes", C.DUCKDB_TYPE_BIGINT},
+		{"batches", C.DUCKDB_TYPE_BIGINT},
+		{"total_ms", C.DUCKDB_TYPE_DOUBLE},
+		{"error", C.DUCKDB_TYPE_VARCHAR},
+		{"remote_plan", C.DUCKDB_TYPE_VARCHAR},
+	},
+	Rows: func(args []string) ([][]any, error) {
+		withRemotePlan, err := parseBoolArg("remote_plan", args[1])
+		if err != nil {
+			return nil, err
+		}
+		withPartitions, err := parseBoolArg("partitions", args[2])
+		if err != nil {
+			return nil, err
+		}
+
+		scans, err := captureScans(args[0])
+		if err != nil {
+			return nil, err
+		}
+
+		rows := make([][]any, len(scans))
+		for i, q := range scans {
+			rows[i] = explainScan(q, withPartitions, withRemotePlan)
+		}
+		return rows, nil
+	},
+}
+
+// parseBoolArg parses an optional boolean named parameter; "" (unset) is false.
+func parseBoolArg(name, arg string) (bool, error) {
+	if arg == "" {
+		return false, nil
+	}
+	v, err := strconv.ParseBool(arg)
+	if err != nil {
+		return false, fmt.Errorf("%s: expected a boolean, got %q", name, arg)
+	}
+	return v, nil
+}
+
+// captureScans runs sql on a side connection and returns the remote scans it
+// made. Scans run by other connections at the same time are not included.
+func captureScans(sql string) ([]stats.Query, error) {
+	var conn duckdb.Connection
+	if state := duckdb.Connect(extensionDB, &conn); state == duckdb.STATE_ERROR {
+		return nil, fmt.Errorf("failed to open connection")
+	}
+	defer duckdb.Disconnect(&conn)
+
+	var cctx C.duckdb_client_context
+	C.duckdb_connection_get_client_context(C.duckdb_connection(conn.Ptr), &cctx)
+	connID := uint64(C.duckdb_client_context_get_connection_id(cctx))
+	C.duckdb_destroy_client_context(&cctx)
+
+	capture := stats.Default.StartCapture(connID)
+	cSQL := C.CString(sql)
+	var result C.duckdb_result
+	state := C.duckdb_query(C.duckdb_connection(conn.Ptr), cSQL, &result)
+	C.free(unsafe.Pointer(cSQL))
+	var queryErr error
+	if state == C.DuckDBError {
+		queryErr = fmt.Errorf("query failed: %s", C.GoString(C.duckdb_result_error(&result)))
+	}
+	// Destroying the result tears down the plan, which finishes scans stopped early by LIMIT
+	C.duckdb_destroy_result(&result)
+	scans := stats.Default.StopCapture(capture)
+
+	if queryErr != nil && len(scans) == 0 {
+		return nil, queryErr
+	}
+	return scans, nil
+}
+
+// explainScan builds the output row for one captured scan, asking the server
+// for the pushed query's schema and, if requested, how it plans it.
+func explainScan(q stats.Query, withPartitions, withRemotePlan bool) []any {
+	pushedColumns := "*"
+	if q.Columns != nil {
+		quoted := make([]string, len(q.Columns))
+		for i, col := range q.Columns {
+			quoted[i] = `"` + strings.ReplaceAll(col, `"`, `""`) + `"`
+		}
+		pushedColumns = strings.Join(quoted, ", ")
+	}
+
+	var remoteSchema, endpoints, estimated, remotePlan, errVal any
+	if q.Error != "" {
+		errVal = q.Error
+	}
+
+	_, username, password, skipVerify := GetDuckArrowConfig()
+	cfg := flight.Config{URI: q.URI, Username: username, Password: password, SkipVerify: skipVerify}
+	ctx := context.Background()
+	if connResult, err := flight.GetConnection(ctx, cfg); err == nil {
+		if schema, err := connResult.Client.Schema(ctx, q.SQL); err == nil {
+			remoteSchema = formatSchema(schema)
+		} else {
+			remoteSchema = "unavailable: " + err.Error()
+		}
+		if withPartitions {
+			if plan, err := connResult.Client.Plan(ctx, q.SQL); err == nil {
+				endpoints = int64(plan.Endpoints)
+				if plan.EstimatedRows >= 0 {
+					estimated = plan.EstimatedRows
+				}
+			}
+		}
+		if withRemotePlan {
+			if plan, err := connResult.Client.RemotePlan(ctx, q.SQL); err == nil {
+				remotePlan = plan
+			} else {
+				remotePlan = "unavailable: " + err.Error()
+			}
+		}
+		if connResult.IsPooled {
+			flight.ReleaseConnection(cfg)
+		} else {
+			connResult.Client.Close()
+		}
+	}
+
+	return []any{
+		int64(q.ID),
+		q.URI,
+		q.SQL,
+		pushedColumns,
+		nil, // Filters are not pushed down
+		remoteSchema,
+		endpoints,
+		estimated,
+		q.Rows,
+		q.Bytes,
+		q.Batches,
+		durationMillis(q.Total),
+		errVal,
+		remotePlan,
+	}
+}
+
+// formatSchema renders a schema as "name type, ...", quoting names like
+// pushed_columns does.
+func formatSchema(schema *arrow.Schema) string {
+	fields := make([]string, schema.NumFields())
+	for i, f := range schema.Fields() {
+		fields[i] = `"` + strings.ReplaceAll(f.Name, `"`, `""`) + `" ` + f.Type.String()
+	}
+	return strings.Join(fields, ", ")
+}
+
+// RegisterDuckArrowExplainFunction registers duckarrow_explain().
+//
+// Returns:
+//   - duckdb.STATE_OK on success, duckdb.STATE_ERROR on failure
+func RegisterDuckArrowExplainFunction(conn duckdb.Connection) duckdb.State {
+	return registerRowsFunction(conn, duckarrowExplainFunction)
+}
@@ -0,0 +1,181 @@
+// Package arrowgen builds deterministic synthetic Arrow arrays for tests and
+// benchmarks: the conversion benchmarks and the loopback Flight SQL server.
+package arrowgen
+
+import (
+	"fmt"
+	"math/rand"
+
+	"github.com/apache/arrow-go/v18/arrow"
+	"github.com/apache/arrow-go/v18/arrow/array"
+	"github.com/apache/arrow-go/v18/arrow/decimal128"
+	"github.com/apache/arrow-go/v18/arrow/decimal256"
+	"github.com/apache/arrow-go/v18/arrow/memory"
+)
+
+// Options controls the shape of generated arrays.
+type Options struct {
+	NullFraction float64 // Probability that a top-level value (and nested value) is NULL
+	StringLen    int     // Length of generated strings and binaries
+	ListLen      int     // Number of elements per generated list or map
+}
+
+// Array builds a synthetic array of type t with n rows. The generator is
+// deterministic for a given seed so benchmark runs are comparable.
+func Array(t arrow.DataType, n int, opts Options, seed int64) arrow.Array {
+	rng := rand.New(rand.NewSource(seed))
+	bldr := array.NewBuilder(memory.DefaultAllocator, t)
+	defer bldr.Release()
+	for i := 0; i < n; i++ {
+		appendRandom(bldr, rng, opts)
+	}
+	return bldr.NewArray()
+}
+
+// appendRandom appends one random value (or NULL) to bldr.
+func appendRandom(bldr array.Builder, rng *rand.Rand, opts Options) {
+	if opts.NullFraction > 0 && rng.Float64() < opts.NullFraction {
+		bldr.AppendNull()
+		return
+	}
+	switch b := bldr.(type) {
+	case *array.Int8Builder:
+		b.Append(int8(rng.Int()))
+	case *array.Int16Builder:
+		b.Append(int16(rng.Int()))
+	case *array.Int32Builder:
+		b.Append(int32(rng.Int()))
+	case *array.Int64Builder:
+		b.Append(rng.Int63() - rng.Int63())
+	case *array.Uint8Builder:
+		b.Append(uint8(rng.Int()))
+	case *array.Uint16Builder:
+		b.Append(uint16(rng.Int()))
+	case *array.Uint32Builder:
+		b.Append(rng.Uint32())
+	case *array.Uint64Builder:
+		b.Append(rng.Uint64())
+	case *array.Float32Builder:
+		b.Append(rng.Float32())
+	case *array.Float64Builder:
+		b.Append(rng.NormFloat64())
+	case *array.BooleanBuilder:
+		b.Append(rng.Intn(2) == 1)
+	case *array.TimestampBuilder:
+		// Spread around the epoch so pre-1970 values are exercised too
+		b.Append(arrow.Timestamp(rng.Int63n(1<<50) - 1<<49))
+	case *array.Date32Builder:
+		b.Append(arrow.Date32(rng.Int31n(40000) - 20000))
+	case *array.Date64Builder:
+		b.Append(arrow.Date64((rng.Int63n(40000) - 20000) * 86_400_000))
+	case *array.Time32Builder:
+		b.Append(arrow.Time32(rng.Int31n(86_400)))
+	case *array.Time64Builder:
+		b.Append(arrow.Time64(rng.Int63n(86_400_000_000)))
+	case *array.DurationBuilder:
+		b.Append(arrow.Duration(rng.Int63n(1<<40) - 1<<39))
+	case *array.MonthDayNanoIntervalBuilder:
+		b.Append(arrow.MonthDayNanoInterval{Months: rng.Int31n(24), Days: rng.Int31n(60), Nanoseconds: rng.Int63n(86_400_000_000_000)})
+	case *array.DayTimeIntervalBuilder:
+		b.Append(arrow.DayTimeInterval{Days: rng.Int31n(60), Milliseconds: rng.Int31n(86_400_000)})
+	case *array.MonthIntervalBuilder:
+		b.Append(arrow.MonthInterval(rng.Int31n(240)))
+	case *array.StringBuilder:
+		b.Append(randomString(rng, opts.StringLen))
+	case *array.LargeStringBuilder:
+		b.Append(randomString(rng, opts.StringLen))
+	case *array.BinaryBuilder:
+		b.Append([]byte(randomString(rng, opts.StringLen)))
+	case *array.StringViewBuilder:
+		b.Append(randomString(rng, opts.StringLen))
+	case *array.BinaryViewBuilder:
+		b.Append([]byte(randomString(rng, opts.StringLen)))
+	case *array.FixedSizeBinaryBuilder:
+		width := b.Type().(*arrow.FixedSizeBinaryType).ByteWidth
+		buf := make([]byte, width)
+		rng.Read(buf)
+		b.Append(buf)
+	case *array.Decimal128Builder:
+		b.Append(decimal128.FromI64(rng.Int63n(10_000)))
+	case *array.Decimal256Builder:
+		b.Append(decimal256.FromI64(rng.Int63n(10_000)))
+	case *array.StructBuilder:
+		b.Append(true)
+		for i := 0; i < b.NumField(); i++ {
+			appendRandom(b.FieldBuilder(i), rng, opts)
+		}
+	case *array.MapBuilder:
+		b.Append(true)
+		keyOpts := opts
+		keyOpts.NullFraction = 0 // Map keys cannot be NULL
+		for i := 0; i < opts.ListLen; i++ {
+			appendRandom(b.KeyBuilder(), rng, keyOpts)
+			appendRandom(b.ItemBuilder(), rng, opts)
+		}
+	case *array.ListBuilder:
+		b.Append(true)
+		for i := 0; i < opts.ListLen; i++ {
+			appendRandom(b.ValueBuilder(), rng, opts)
+		}
+	case *array.LargeListBuilder:
+		b.Append(true)
+		for i := 0; i < opts.ListLen; i++ {
+			appendRandom(b.ValueBuilder(), rng, opts)
+		}
+	case *array.ListViewBuilder:
+		b.AppendWithSize(true, opts.ListLen)
+		for i := 0; i < opts.ListLen; i++ {
+			appendRandom(b.ValueBuilder(), rng, opts)
+		}
+	case *array.FixedSizeListBuilder:
+		// The list length is part of the type, so ListLen does not apply
+		b.Append(true)
+		n := int(b.Type().(*arrow.FixedSizeListType).Len())
+		for i := 0; i < n; i++ {
+			appendRandom(b.ValueBuilder(), rng, opts)
+		}
+	case *array.SparseUnionBuilder:
+		// Every member gets a slot; only the selected one holds a value
+		codes := b.Type().(arrow.UnionType).TypeCodes()
+		pick := rng.Intn(len(codes))
+		b.Append(codes[pick])
+		for i := range codes {
+			if i == pick {
+				appendRandom(b.Child(i), rng, opts)
+			} else {
+				b.Child(i).AppendEmptyValue()
+			}
+		}
+	case *array.DenseUnionBuilder:
+		codes := b.Type().(arrow.UnionType).TypeCodes()
+		pick := rng.Intn(len(codes))
+		b.Append(codes[pick])
+		appendRandom(b.Child(pick), rng, opts)
+	case interface{ StorageBuilder() array.Builder }:
+		// Extension types are generated as their storage; NULL was already decided
+		storageOpts := opts
+		storageOpts.NullFraction = 0
+		appendRandom(b.StorageBuilder(), rng, storageOpts)
+	default:
+		panic(fmt.Sprintf("arrowgen: unsupported builder %T", bldr))
+	}
+}
+
+const letters = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789"
+
+func randomString(rng *rand.Rand, n int) string {
+	buf := make([]byte, n)
+	for i := range buf {
+		buf[i] = letters[rng.Intn(len(letters))]
+	}
+	return string(buf)
+}
+
+// NestedList returns LIST<LIST<...<elem>>> with the given depth.
+func NestedList(elem arrow.DataType, depth int) arrow.DataType {
+	t := elem
+	for i := 0; i < depth; i++ {
+		t = arrow.ListOf(t)
+	}
+	return t
+}
@@ -0,0 +1,212 @@
+package convert
+
+import (
+	"fmt"
+	"testing"
+
+	"main/internal/arrowgen"
+
+	"github.com/apache/arrow-go/v18/arrow"
+	"github.com/apache/arrow-go/v18/arrow/array"
+	"github.com/apache/arrow-go/v18/arrow/extensions"
+	"github.com/apache/arrow-go/v18/arrow/memory"
+)
+
+// benchRows is the number of rows per synthetic batch, a typical Flight batch size.
+const benchRows = 64 * 1024
+
+// chunkSize matches DuckDB's STANDARD_VECTOR_SIZE used by the scan.
+const chunkSize = 2048
+
+type benchType struct {
+	name string
+	typ  arrow.DataType
+}
+
+// benchTypes lists one Arrow type per conversion case in Convert.
+func benchTypes() []benchType {
+	return []benchType{
+		{"int8", arrow.PrimitiveTypes.Int8},
+		{"int16", arrow.PrimitiveTypes.Int16},
+		{"int32", arrow.PrimitiveTypes.Int32},
+		{"int64", arrow.PrimitiveTypes.Int64},
+		{"uint8", arrow.PrimitiveTypes.Uint8},
+		{"uint16", arrow.PrimitiveTypes.Uint16},
+		{"uint32", arrow.PrimitiveTypes.Uint32},
+		{"uint64", arrow.PrimitiveTypes.Uint64},
+		{"float32", arrow.PrimitiveTypes.Float32},
+		{"float64", arrow.PrimitiveTypes.Float64},
+		{"bool", arrow.FixedWidthTypes.Boolean},
+		{"timestamp_s", arrow.FixedWidthTypes.Timestamp_s},
+		{"timestamp_ms", arrow.FixedWidthTypes.Timestamp_ms},
+		{"timestamp_us", arrow.FixedWidthTypes.Timestamp_us},
+		{"timestamp_ns", arrow.FixedWidthTypes.Timestamp_ns},
+		// FixedWidthTypes timestamps are zoned (UTC); naive ones map to TIMESTAMP_S/MS/NS
+		{"timestamp_s_naive", &arrow.TimestampType{Unit: arrow.Second}},
+		{"timestamp_ns_naive", &arrow.TimestampType{Unit: arrow.Nanosecond}},
+		{"date32", arrow.FixedWidthTypes.Date32},
+		{"date64", arrow.FixedWidthTypes.Date64},
+		{"time32_ms", arrow.FixedWidthTypes.Time32ms},
+		{"time64_ns", arrow.FixedWidthTypes.Time64ns},
+		{"duration_ns", arrow.FixedWidthTypes.Duration_ns},
+		{"interval_month_day_nano", arrow.FixedWidthTypes.MonthDayNanoInterval},
+		{"utf8", arrow.BinaryTypes.String},
+		{"large_utf8", arrow.BinaryTypes.LargeString},
+		{"binary", arrow.BinaryTypes.Binary},
+		{"large_binary", arrow.BinaryTypes.LargeBinary},
+		{"utf8_view", arrow.BinaryTypes.StringView},
+		{"binary_view", arrow.BinaryTypes.BinaryView},
+		{"fixed_size_binary16", &arrow.FixedSizeBinaryType{ByteWidth: 16}},
+		{"decimal128_9", &arrow.Decimal128Type{Precision: 9, Scale: 2}},
+		{"decimal128_18", &arrow.Decimal128Type{Precision: 18, Scale: 2}},
+		{"decimal128_38", &arrow.Decimal128Type{Precision: 38, Scale: 2}},
+		{"decimal256_38", &arrow.Decimal256Type{Precision: 38, Scale: 2}},
+		{"decimal256_50", &arrow.Decimal256Type{Precision: 50, Scale: 10}},
+		{"struct", arrow.StructOf(
+			arrow.Field{Name: "id", Type: arrow.PrimitiveTypes.Int64, Nullable: true},
+			arrow.Field{Name: "name", Type: arrow.BinaryTypes.String, Nullable: true},
+		)},
+		{"list_int64", arrow.ListOf(arrow.PrimitiveTypes.Int64)},
+		{"large_list_int64", arrow.LargeListOf(arrow.PrimitiveTypes.Int64)},
+		{"map_utf8_int64", arrow.MapOf(arrow.BinaryTypes.String, arrow.PrimitiveTypes.Int64)},
+		{"list_view_int64", arrow.ListViewOf(arrow.PrimitiveTypes.Int64)},
+		{"fixed_size_list_float32_4", arrow.FixedSizeListOf(4, arrow.PrimitiveTypes.Float32)},
+		// A document-like LIST<STRUCT<id, tags LIST<utf8>>>
+		{"list_struct_list", arrow.ListOf(arrow.StructOf(
+			arrow.Field{Name: "id", Type: arrow.PrimitiveTypes.Int64, Nullable: true},
+			arrow.Field{Name: "tags", Type: arrow.ListOf(arrow.BinaryTypes.String), Nullable: true},
+		))},
+		{"sparse_union_int64_utf8", arrow.SparseUnionOf([]arrow.Field{
+			{Name: "i", Type: arrow.PrimitiveTypes.Int64, Nullable: true},
+			{Name: "s", Type: arrow.BinaryTypes.String, Nullable: true},
+		}, []arrow.UnionTypeCode{0, 1})},
+		{"dense_union_int64_utf8", arrow.DenseUnionOf([]arrow.Field{
+			{Name: "i", Type: arrow.PrimitiveTypes.Int64, Nullable: true},
+			{Name: "s", Type: arrow.BinaryTypes.String, Nullable: true},
+		}, []arrow.UnionTypeCode{0, 1})},
+		{"uuid_extension", extensions.NewUUIDType()},
+	}
+}
+
+// BenchmarkConvert measures every conversion kernel across NULL densities.
+// Reported MB/s is Arrow input bytes; rows/s is rows written to DuckDB vectors.
+//
+// Compare runs with benchstat:
+//
+//	make bench BENCH_OUT=old.txt
+//	make bench BENCH_OUT=new.txt
+//	benchstat old.txt new.txt
+func BenchmarkConvert(b *testing.B) {
+	for _, bt := range benchTypes() {
+		for _, nulls := range []float64{0, 0.1, 0.5} {
+			opts := arrowgen.Options{NullFraction: nulls, StringLen: 16, ListLen: 4}
+			b.Run(fmt.Sprintf("type=%s/nulls=%.1f", bt.name, nulls), func(b *testing.B) {
+				benchmarkConvert(b, bt.typ, opts)
+			})
+		}
+	}
+}
+
+// BenchmarkConvertStringLength measures VARCHAR conversion across string lengths,
+// straddling DuckDB's 12-byte inline string limit.
+func BenchmarkConvertStringLength(b *testing.B) {
+	for _, length := range []int{4, 12, 13, 64, 1024} {
+		opts := arrowgen.Options{NullFraction: 0.1, StringLen: length}
+		b.Run(fmt.Sprintf("len=%d", length), func(b *testing.B) {
+			benchmarkConvert(b, arrow.BinaryTypes.String, opts)
+		})
+	}
+}
+
+// BenchmarkConvertStringViewLength is BenchmarkConvertStringLength for Utf8View,
+// whose values up to 12 bytes are copied without going through the vector.
+func BenchmarkConvertStringViewLength(b *testing.B) {
+	for _, length := range []int{4, 12, 13, 64} {
+		opts := arrowgen.Options{NullFraction: 0.1, StringLen: length}
+		b.Run(fmt.Sprintf("len=%d", length), func(b *testing.B) {
+			benchmarkConvert(b, arrow.BinaryTypes.StringView, opts)
+		})
+	}
+}
+
+// BenchmarkConvertNestedList measures LIST<...<int64>> conversion across nesting depths.
+func BenchmarkConvertNestedList(b *testing.B) {
+	for _, depth := range []int{1, 2, 3} {
+		opts := arrowgen.Options{NullFraction: 0.1, ListLen: 3}
+		b.Run(fmt.Sprintf("depth=%d", depth), func(b *testing.B) {
+			benchmarkConvert(b, arrowgen.NestedList(arrow.PrimitiveTypes.Int64, depth), opts)
+		})
+	}
+}
+
+// BenchmarkConvertEmbedding measures FixedSizeList<float32, dim> to ARRAY
+// conversion at typical embedding sizes.
+func BenchmarkConvertEmbedding(b *testing.B) {
+	for _, dim := range []int32{128, 768} {
+		b.Run(fmt.Sprintf("dim=%d", dim), func(b *testing.B) {
+			benchmarkConvert(b, arrow.FixedSizeListOf(dim, arrow.PrimitiveTypes.Float32), arrowgen.Options{NullFraction: 0.01})
+		})
+	}
+}
+
+// benchmarkConvert converts one synthetic batch per iteration, in DuckDB-sized chunks,
+// exactly as scanArrowData slices record batches.
+func benchmarkConvert(b *testing.B, t arrow.DataType, opts arrowgen.Options) {
+	arr := arrowgen.Array(t, benchRows, opts, 42)
+	defer arr.Release()
+	vec := NewMemVector(t, chunkSize)
+
+	b.SetBytes(arrayBytes(arr))
+	b.ReportAllocs()
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		for offset := 0; offset < benchRows; offset += chunkSize {
+			vec.Reset()
+			if err := Convert(arr, vec, offset, min(chunkSize, benchRows-offset)); err != nil {
+				b.Fatal(err)
+			}
+		}
+	}
+	b.ReportMetric(float64(benchRows)*float64(b.N)/b.Elapsed().Seconds(), "rows/s")
+}
+
+// BenchmarkConvertRunEnd measures run-end encoded columns across run lengths,
+// from one row per run to one run per batch (a partition key).
+func BenchmarkConvertRunEnd(b *testing.B) {
+	for _, elem := range []benchType{
+		{"int64", arrow.PrimitiveTypes.Int64},
+		{"utf8", arrow.BinaryTypes.String},
+	} {
+		for _, runLen := range []int{1, 64, benchRows} {
+			b.Run(fmt.Sprintf("type=%s/run=%d", elem.name, runLen), func(b *testing.B) {
+				numRuns := benchRows / runLen
+				values := arrowgen.Array(elem.typ, numRuns, arrowgen.Options{StringLen: 16}, 42)
+				defer values.Release()
+				ends := make([]int32, numRuns)
+				for i := range ends {
+					ends[i] = int32((i + 1) * runLen)
+				}
+				endsBldr := array.NewInt32Builder(memory.DefaultAllocator)
+				defer endsBldr.Release()
+				endsBldr.AppendValues(ends, nil)
+				runEnds := endsBldr.NewArray()
+				defer runEnds.Release()
+				arr := array.NewRunEndEncodedArray(runEnds, values, benchRows, 0)
+				defer arr.Release()
+
+				vec := NewMemVector(arr.DataType(), chunkSize)
+				b.SetBytes(arrayBytes(arr))
+				b.ReportAllocs()
+				b.ResetTimer()
+				for i := 0; i < b.N; i++ {
+					for offset := 0; offset < benchRows; offset += chunkSize {
+						vec.Reset()
+						if err := Convert(arr, vec, offset, min(chunkSize, benchRows-offset)); err != nil {
+							b.Fatal(err)
+						}
+					}
+				}
+			})
+		}
+	}
+}
@@ -0,0 +1,71 @@
+package convert
+
+import (
+	"encoding/binary"
+	"unsafe"
+
+	"github.com/apache/arrow-go/v18/arrow"
+)
+
+// copyValidity marks the NULL rows of arr[offset:offset+count] in vec's
+// validity mask, 64 rows at a time. Arrow bitmaps and DuckDB validity masks
+// use the same convention (LSB first, bit set means valid), so each mask word
+// is a shifted load from the Arrow bitmap. Columns without NULLs leave the
+// mask untouched, so DuckDB never allocates it.
+func copyValidity(arr arrow.Array, vec Vector, offset, count int) {
+	if count == 0 || arr.NullN() == 0 {
+		return
+	}
+	mask := vec.ValidityMask(count)
+	bitmap := arr.NullBitmapBytes()
+	if len(bitmap) == 0 {
+		// Arrays with NULLs but no bitmap (arrow.NULL) are entirely NULL
+		for i := range mask {
+			mask[i] = 0
+		}
+		return
+	}
+	start := arr.Data().Offset() + offset
+	for w := range mask {
+		mask[w] = loadBits(bitmap, start+w*64)
+	}
+}
+
+// loadBits returns the 64 bits of an LSB-first bitmap starting at bit pos.
+// Bits past the end of the bitmap read as valid.
+func loadBits(bitmap []byte, pos int) uint64 {
+	byteIdx, shift := pos/8, uint(pos%8)
+	src := bitmap[min(byteIdx, len(bitmap)):]
+	if len(src) < 9 {
+		var buf [9]byte
+		n := copy(buf[:], src)
+		for i := n; i < len(buf); i++ {
+			buf[i] = 0xFF
+		}
+		src = buf[:]
+	}
+	word := binary.LittleEndian.Uint64(src)
+	if shift != 0 {
+		word = word>>shift | uint64(src[8])<<(64-shift)
+	}
+	return word
+}
+
+// copyValues copies count values starting at offset into vec's data buffer,
+// for Arrow types stored with the same width in DuckDB. Values under NULL rows
+// are copied too; DuckDB ignores them.
+func copyValues[T any](vec Vector, values []T, offset, count int) {
+	if count == 0 {
+		return
+	}
+	copy(unsafe.Slice((*T)(vec.Data()), count), values[offset:offset+count])
+}
+
+// valueData returns the data buffer of a variable-length binary or string
+// array. Its value offsets index into this buffer directly.
+func valueData(arr arrow.Array) []byte {
+	if buf := arr.Data().Buffers()[2]; buf != nil {
+		return buf.Bytes()
+	}
+	return nil
+}
@@ -0,0 +1,364 @@
+package convert
+
+import (
+	"fmt"
+	"unsafe"
+
+	"github.com/apache/arrow-go/v18/arrow"
+	"github.com/apache/arrow-go/v18/arrow/array"
+)
+
+// Options holds the conversion choices that change a column's DuckDB type.
+// A scan captures them once at bind, so the types it declares and the values
+// it writes agree even if the settings behind them change mid-scan.
+type Options struct {
+	// WideDecimals maps decimals with more digits than DuckDB's DECIMAL holds.
+	WideDecimals DecimalMode
+}
+
+// Convert converts with the default Options.
+func Convert(arrowCol arrow.Array, vec Vector, offset, count int) error {
+	return Options{}.Convert(arrowCol, vec, offset, count)
+}
+
+// Convert writes count rows of arrowCol, starting at offset, into rows
+// [0, count) of vec. The DuckDB type of vec must match the extension's
+// arrowTypeToDuckDB mapping for the Arrow type under the same Options.
+func (o Options) Convert(arrowCol arrow.Array, vec Vector, offset, count int) error {
+	if col, ok := arrowCol.(array.ExtensionArray); ok {
+		return o.ConvertField(arrow.Field{Type: col.DataType()}, col, vec, offset, count)
+	}
+
+	// NULLs are marked for every type up front, so the kernels below only skip them
+	copyValidity(arrowCol, vec, offset, count)
+
+	// Handle type-specific conversion
+	switch col := arrowCol.(type) {
+	case *array.String:
+		vec.AssignStrings32(valueData(col), col.ValueOffsets()[offset:offset+count+1])
+
+	case *array.LargeString:
+		vec.AssignStrings64(valueData(col), col.ValueOffsets()[offset:offset+count+1])
+
+	case *array.Int64:
+		copyValues(vec, col.Int64Values(), offset, count)
+
+	case *array.Int32:
+		copyValues(vec, col.Int32Values(), offset, count)
+
+	case *array.Int16:
+		copyValues(vec, col.Int16Values(), offset, count)
+
+	case *array.Int8:
+		copyValues(vec, col.Int8Values(), offset, count)
+
+	case *array.Uint64:
+		copyValues(vec, col.Uint64Values(), offset, count)
+
+	case *array.Uint32:
+		copyValues(vec, col.Uint32Values(), offset, count)
+
+	case *array.Uint16:
+		copyValues(vec, col.Uint16Values(), offset, count)
+
+	case *array.Uint8:
+		copyValues(vec, col.Uint8Values(), offset, count)
+
+	case *array.Float64:
+		copyValues(vec, col.Float64Values(), offset, count)
+
+	case *array.Float32:
+		copyValues(vec, col.Float32Values(), offset, count)
+
+	case *array.Boolean:
+		ptr := (*uint8)(vec.Data())
+		data := unsafe.Slice(ptr, count)
+		for i := 0; i < count; i++ {
+			srcIdx := offset + i
+			if col.IsNull(srcIdx) {
+				continue
+			}
+			if col.Value(srcIdx) {
+				data[i] = 1
+			} else {
+				data[i] = 0
+			}
+		}
+
+	case *array.Timestamp:
+		// Naive timestamps map to the DuckDB TIMESTAMP type of the same unit.
+		// Zoned ones map to TIMESTAMPTZ, which is microseconds since epoch.
+		dt := col.DataType().(*arrow.TimestampType)
+		if dt.TimeZone == "" {
+			copyValues(vec, col.TimestampValues(), offset, count)
+			break
+		}
+		data := unsafe.Slice((*int64)(vec.Data()), count)
+		values := col.TimestampValues()[offset : offset+count]
+		switch dt.Unit {
+		case arrow.Second:
+			scaleUp(data, values, 1_000_000)
+		case arrow.Millisecond:
+			scaleUp(data, values, 1_000)
+		case arrow.Microsecond:
+			copyValues(vec, values, 0, count)
+		case arrow.Nanosecond:
+			nanosToMicros(data, values)
+		}
+
+	case *array.Date32:
+		// DuckDB DATE is days since epoch
+		copyValues(vec, col.Date32Values(), offset, count)
+
+	case *array.Date64:
+		// Date64 is milliseconds since epoch, convert to days for DuckDB
+		millisToDays(unsafe.Slice((*int32)(vec.Data()), count), col.Date64Values()[offset:offset+count])
+
+	case *array.Time32:
+		// DuckDB TIME is microseconds since midnight
+		data := unsafe.Slice((*int64)(vec.Data()), count)
+		values := col.Time32Values()[offset : offset+count]
+		switch col.DataType().(*arrow.Time32Type).Unit {
+		case arrow.Second:
+			scaleUp(data, values, 1_000_000)
+		case arrow.Millisecond:
+			scaleUp(data, values, 1_000)
+		default:
+			scaleUp(data, values, 1)
+		}
+
+	case *array.Time64:
+		// DuckDB TIME is microseconds since midnight
+		data := unsafe.Slice((*int64)(vec.Data()), count)
+		values := col.Time64Values()[offset : offset+count]
+		if col.DataType().(*arrow.Time64Type).Unit == arrow.Nanosecond {
+			nanosToMicros(data, values)
+		} else {
+			copyValues(vec, values, 0, count)
+		}
+
+	case *array.Duration:
+		// DuckDB INTERVAL keeps durations in its microseconds field
+		data := unsafe.Slice((*Interval)(vec.Data()), count)
+		values := col.DurationValues()[offset : offset+count]
+		switch col.DataType().(*arrow.DurationType).Unit {
+		case arrow.Second:
+			scaleToIntervals(data, values, 1_000_000)
+		case arrow.Millisecond:
+			scaleToIntervals(data, values, 1_000)
+		case arrow.Microsecond:
+			scaleToIntervals(data, values, 1)
+		case arrow.Nanosecond:
+			nanosToIntervals(data, values)
+		}
+
+	case *array.MonthDayNanoInterval:
+		monthDayNanosToIntervals(unsafe.Slice((*Interval)(vec.Data()), count), col.MonthDayNanoIntervalValues()[offset:offset+count])
+
+	case *array.DayTimeInterval:
+		dayTimesToIntervals(unsafe.Slice((*Interval)(vec.Data()), count), col.DayTimeIntervalValues()[offset:offset+count])
+
+	case *array.MonthInterval:
+		monthsToIntervals(unsafe.Slice((*Interval)(vec.Data()), count), col.MonthIntervalValues()[offset:offset+count])
+
+	case *array.Binary:
+		// Convert to BLOB
+		vec.AssignStrings32(valueData(col), col.ValueOffsets()[offset:offset+count+1])
+
+	case *array.LargeBinary:
+		// Convert to BLOB
+		vec.AssignStrings64(valueData(col), col.ValueOffsets()[offset:offset+count+1])
+
+	case *array.StringView:
+		convertViews(col, vec, offset, count)
+
+	case *array.BinaryView:
+		convertViews(col, vec, offset, count)
+
+	case *array.FixedSizeBinary:
+		// Convert to VARCHAR (UUIDs are typically 16-byte FixedSizeBinary)
+		for i := 0; i < count; i++ {
+			srcIdx := offset + i
+			if col.IsNull(srcIdx) {
+				continue
+			}
+			data := col.Value(srcIdx)
+			var val string
+			if len(data) == 16 {
+				// Format as UUID
+				val = fmt.Sprintf("%08x-%04x-%04x-%04x-%012x",
+					data[0:4], data[4:6], data[6:8], data[8:10], data[10:16])
+			} else {
+				val = fmt.Sprintf("%x", data)
+			}
+			vec.AssignString(i, val)
+		}
+
+	case *array.Decimal128:
+		if err := o.convertDecimal(col, vec, offset, count); err != nil {
+			return err
+		}
+
+	case *array.Decimal256:
+		if err := o.convertDecimal(col, vec, offset, count); err != nil {
+			return err
+		}
+
+	case *array.Struct:
+		// Convert STRUCT by recursively converting each field
+		structType := col.DataType().(*arrow.StructType)
+		numFields := structType.NumFields()
+
+		// Convert each field recursively, with its metadata for extension types
+		for fieldIdx := 0; fieldIdx < numFields; fieldIdx++ {
+			childArr := col.Field(fieldIdx)
+			childVec := vec.StructChild(fieldIdx)
+			if err := o.ConvertField(structType.Field(fieldIdx), childArr, childVec, offset, count); err != nil {
+				return fmt.Errorf("struct field %d: %w", fieldIdx, err)
+			}
+		}
+
+	case *array.List:
+		if err := convertList(o, vec, col.Offsets(), offset, count, col.ListValues()); err != nil {
+			return fmt.Errorf("list elements: %w", err)
+		}
+
+	case *array.LargeList:
+		if err := convertList(o, vec, col.Offsets(), offset, count, col.ListValues()); err != nil {
+			return fmt.Errorf("large list elements: %w", err)
+		}
+
+	case *array.FixedSizeList:
+		// DuckDB ARRAY stores size elements per row contiguously, like Arrow, so
+		// the child slice for these rows (including NULL rows) converts in one pass
+		size := int(col.DataType().(*arrow.FixedSizeListType).Len())
+		start := (col.Data().Offset() + offset) * size
+		if !NativeArray(col.DataType().(*arrow.FixedSizeListType)) {
+			// Sizes DuckDB's ARRAY can't hold are declared as LIST
+			offsets := make([]int64, count+1)
+			for i := range offsets {
+				offsets[i] = int64(start + i*size)
+			}
+			if err := convertList(o, vec, offsets, 0, count, col.ListValues()); err != nil {
+				return fmt.Errorf("fixed size list elements: %w", err)
+			}
+			break
+		}
+		if err := o.Convert(col.ListValues(), vec.ArrayChild(), start, count*size); err != nil {
+			return fmt.Errorf("array elements: %w", err)
+		}
+
+	case *array.ListView:
+		if err := o.convertListView(col, vec, offset, count); err != nil {
+			return err
+		}
+
+	case *array.LargeListView:
+		if err := o.convertListView(col, vec, offset, count); err != nil {
+			return err
+		}
+
+	case *array.Map:
+		// DuckDB MAP is a LIST of STRUCT{key, value}
+		if err := convertList(o, vec, col.Offsets(), offset, count, col.Keys(), col.Items()); err != nil {
+			return fmt.Errorf("map entries: %w", err)
+		}
+
+	case *array.SparseUnion:
+		if !NativeUnion(col.DataType().(arrow.UnionType)) {
+			convertToStrings(col, vec, offset, count)
+			break
+		}
+		if err := o.convertSparseUnion(col, vec, offset, count); err != nil {
+			return err
+		}
+
+	case *array.DenseUnion:
+		if !NativeUnion(col.DataType().(arrow.UnionType)) {
+			convertToStrings(col, vec, offset, count)
+			break
+		}
+		if err := o.convertDenseUnion(col, vec, offset, count); err != nil {
+			return err
+		}
+
+	case *array.RunEndEncoded:
+		if !NativeRunEnd(col.DataType().(*arrow.RunEndEncodedType)) {
+			convertToStrings(col, vec, offset, count)
+			break
+		}
+		if err := o.convertRunEnd(col, vec, offset, count); err != nil {
+			return err
+		}
+
+	default:
+		convertToStrings(arrowCol, vec, offset, count)
+	}
+
+	return nil
+}
+
+// MaxArraySize is the largest size of a DuckDB ARRAY.
+const MaxArraySize = 100000
+
+// NativeArray reports whether fixed size list columns of type t are converted
+// to a DuckDB ARRAY, whose size must be 1 to MaxArraySize. Others are
+// converted to LIST.
+func NativeArray(t *arrow.FixedSizeListType) bool {
+	return t.Len() >= 1 && t.Len() <= MaxArraySize
+}
+
+// convertList converts LIST and MAP columns from their Arrow offsets: the
+// list entries in one pass, then all of the chunk's child elements with one
+// Convert per child array. A LIST has one child array; a MAP has its keys and
+// values, which become the fields of DuckDB's entry STRUCT.
+func convertList[O int32 | int64](o Options, vec Vector, offsets []O, offset, count int, children ...arrow.Array) error {
+	first, n := listEntries(unsafe.Slice((*ListEntry)(vec.Data()), count), offsets[offset:offset+count+1])
+	if n > 0 {
+		vec.ListReserve(uint64(n))
+		targets := []Vector{vec.ListChild()}
+		if len(children) == 2 {
+			targets = []Vector{targets[0].StructChild(0), targets[0].StructChild(1)}
+		}
+		for i, child := range children {
+			if err := o.Convert(child, targets[i], first, n); err != nil {
+				return err
+			}
+		}
+	}
+	vec.ListSetSize(uint64(n))
+	return nil
+}
+
+// listEntries sets one DuckDB list entry per row from the rows' Arrow offsets
+// and returns the child range the rows span. Entries are relative to the
+// range start rather than packed, so the loop has no branches, and NULL rows
+// that own child values (which Arrow allows) don't shift the rows after them.
+func listEntries[O int32 | int64](entries []ListEntry, offsets []O) (first, n int) {
+	offsets = offsets[:len(entries)+1]
+	base := offsets[0]
+	for i := range entries {
+		entries[i] = ListEntry{Offset: uint64(offsets[i] - base), Length: uint64(offsets[i+1] - offsets[i])}
+	}
+	return int(base), int(offsets[len(entries)] - base)
+}
+
+// convertToStrings is the fallback for unmapped types: values are converted
+// to strings using ValueStr if available.
+func convertToStrings(arrowCol arrow.Array, vec Vector, offset, count int) {
+	for i := 0; i < count; i++ {
+		srcIdx := offset + i
+		if arrowCol.IsNull(srcIdx) {
+			continue
+		}
+
+		var val string
+		if stringer, ok := arrowCol.(interface{ ValueStr(int) string }); ok {
+			val = stringer.ValueStr(srcIdx)
+		} else {
+			val = fmt.Sprintf("%v", arrowCol.GetOneForMarshal(srcIdx))
+		}
+
+		vec.AssignString(i, val)
+	}
+}
@@ -0,0 +1,980 @@
+package convert
+
+import (
+	"fmt"
+	"math"
+	"math/big"
+	"strings"
+	"testing"
+
+	"main/internal/arrowgen"
+
+	"github.com/apache/arrow-go/v18/arrow"
+	"github.com/apache/arrow-go/v18/arrow/array"
+	"github.com/apache/arrow-go/v18/arrow/decimal128"
+	"github.com/apache/arrow-go/v18/arrow/decimal256"
+	"github.com/apache/arrow-go/v18/arrow/extensions"
+	"github.com/apache/arrow-go/v18/arrow/memory"
+)
+
+func TestConvertInt64WithNulls(t *testing.T) {
+	bldr := array.NewInt64Builder(memory.DefaultAllocator)
+	defer bldr.Release()
+	bldr.AppendValues([]int64{1, 2, 0, 4, 5}, []bool{true, true, false, true, true})
+	arr := bldr.NewArray()
+	defer arr.Release()
+
+	vec := NewMemVector(arr.DataType(), 2048)
+	// Convert rows [1, 5) to check the source offset is honoured
+	if err := Convert(arr, vec, 1, 4); err != nil {
+		t.Fatalf("Convert: %v", err)
+	}
+
+	got := memSlice[int64](vec, 4)
+	if got[0] != 2 || got[2] != 4 || got[3] != 5 {
+		t.Errorf("values = %v, want [2 _ 4 5]", got)
+	}
+	if !vec.IsNull(1) {
+		t.Error("row 1 should be NULL")
+	}
+	if vec.IsNull(0) || vec.IsNull(2) || vec.IsNull(3) {
+		t.Error("only row 1 should be NULL")
+	}
+}
+
+func TestConvertStrings(t *testing.T) {
+	bldr := array.NewStringBuilder(memory.DefaultAllocator)
+	defer bldr.Release()
+	bldr.AppendValues([]string{"short", "a string longer than twelve bytes", ""}, nil)
+	bldr.AppendNull()
+	arr := bldr.NewArray()
+	defer arr.Release()
+
+	vec := NewMemVector(arr.DataType(), 2048)
+	if err := Convert(arr, vec, 0, arr.Len()); err != nil {
+		t.Fatalf("Convert: %v", err)
+	}
+
+	want := []string{"short", "a string longer than twelve bytes", ""}
+	for i, w := range want {
+		if vec.String(i) != w {
+			t.Errorf("row %d = %q, want %q", i, vec.String(i), w)
+		}
+	}
+	if !vec.IsNull(3) {
+		t.Error("row 3 should be NULL")
+	}
+}
+
+func TestConvertTimestampNaive(t *testing.T) {
+	// Naive timestamps map to TIMESTAMP_S/MS/NS, so values are copied in their own unit
+	for _, unit := range []arrow.TimeUnit{arrow.Second, arrow.Millisecond, arrow.Microsecond, arrow.Nanosecond} {
+		t.Run(unit.String(), func(t *testing.T) {
+			dt := &arrow.TimestampType{Unit: unit}
+			bldr := array.NewTimestampBuilder(memory.DefaultAllocator, dt)
+			defer bldr.Release()
+			bldr.AppendValues([]arrow.Timestamp{-1_001, 1_700_000_000_123_456_789}, nil)
+			arr := bldr.NewArray()
+			defer arr.Release()
+
+			vec := NewMemVector(dt, 2048)
+			if err := Convert(arr, vec, 0, arr.Len()); err != nil {
+				t.Fatalf("Convert: %v", err)
+			}
+			if got := memSlice[int64](vec, 2); got[0] != -1_001 || got[1] != 1_700_000_000_123_456_789 {
+				t.Errorf("values = %v, want them unchanged", got)
+			}
+		})
+	}
+}
+
+func TestConvertTimestampZoned(t *testing.T) {
+	tests := []struct {
+		unit  arrow.TimeUnit
+		value arrow.Timestamp
+		want  int64 // Microseconds
+	}{
+		{arrow.Second, 2, 2_000_000},
+		{arrow.Millisecond, 2, 2_000},
+		{arrow.Microsecond, 2, 2},
+		{arrow.Nanosecond, 2_000, 2},
+		// Pre-epoch values round down, not toward zero
+		{arrow.Second, -2, -2_000_000},
+		{arrow.Nanosecond, -1, -1},
+		{arrow.Nanosecond, -1_000, -1},
+		{arrow.Nanosecond, -1_001, -2},
+	}
+
+	for _, tt := range tests {
+		t.Run(tt.unit.String(), func(t *testing.T) {
+			dt := &arrow.TimestampType{Unit: tt.unit, TimeZone: "America/New_York"}
+			bldr := array.NewTimestampBuilder(memory.DefaultAllocator, dt)
+			defer bldr.Release()
+			bldr.Append(tt.value)
+			arr := bldr.NewArray()
+			defer arr.Release()
+
+			vec := NewMemVector(dt, 2048)
+			if err := Convert(arr, vec, 0, 1); err != nil {
+				t.Fatalf("Convert: %v", err)
+			}
+			if got := memSlice[int64](vec, 1)[0]; got != tt.want {
+				t.Errorf("micros = %d, want %d", got, tt.want)
+			}
+		})
+	}
+}
+
+func TestConvertDate64PreEpoch(t *testing.T) {
+	bldr := array.NewDate64Builder(memory.DefaultAllocator)
+	defer bldr.Release()
+	// 1969-12-31 23:59:59.999, the epoch, 1969-12-31 00:00:00 and 1969-12-30 23:59:59.999
+	bldr.AppendValues([]arrow.Date64{-1, 0, -86_400_000, -86_400_001}, nil)
+	arr := bldr.NewArray()
+	defer arr.Release()
+
+	vec := NewMemVector(arr.DataType(), 2048)
+	if err := Convert(arr, vec, 0, arr.Len()); err != nil {
+		t.Fatalf("Convert: %v", err)
+	}
+	got := memSlice[int32](vec, 4)
+	if want := []int32{-1, 0, -1, -2}; fmt.Sprint(got) != fmt.Sprint(want) {
+		t.Errorf("days = %v, want %v", got, want)
+	}
+}
+
+func TestConvertDuration(t *testing.T) {
+	for _, tc := range []struct {
+		unit arrow.TimeUnit
+		in   []arrow.Duration
+		want []int64
+	}{
+		{arrow.Second, []arrow.Duration{-2, 0, 3}, []int64{-2_000_000, 0, 3_000_000}},
+		{arrow.Millisecond, []arrow.Duration{-2, 0, 3}, []int64{-2_000, 0, 3_000}},
+		{arrow.Microsecond, []arrow.Duration{-2, 0, 3}, []int64{-2, 0, 3}},
+		// Nanoseconds round down, matching timestamps
+		{arrow.Nanosecond, []arrow.Duration{-1, 999, 1_000}, []int64{-1, 0, 1}},
+	} {
+		dt := &arrow.DurationType{Unit: tc.unit}
+		bldr := array.NewDurationBuilder(memory.DefaultAllocator, dt)
+		bldr.AppendValues(tc.in, nil)
+		arr := bldr.NewArray()
+		bldr.Release()
+
+		vec := NewMemVector(dt, 2048)
+		if err := Convert(arr, vec, 0, arr.Len()); err != nil {
+			t.Fatalf("%s: Convert: %v", tc.unit, err)
+		}
+		for i, got := range memSlice[Interval](vec, len(tc.want)) {
+			if want := (Interval{Micros: tc.want[i]}); got != want {
+				t.Errorf("%s: row %d = %+v, want %+v", tc.unit, i, got, want)
+			}
+		}
+		arr.Release()
+	}
+}
+
+func TestConvertIntervals(t *testing.T) {
+	mdn := array.NewMonthDayNanoIntervalBuilder(memory.DefaultAllocator)
+	defer mdn.Release()
+	mdn.Append(arrow.MonthDayNanoInterval{Months: 14, Days: -3, Nanoseconds: -1})
+	dayTime := array.NewDayTimeIntervalBuilder(memory.DefaultAllocator)
+	defer dayTime.Release()
+	dayTime.Append(arrow.DayTimeInterval{Days: 2, Milliseconds: -1_500})
+	months := array.NewMonthIntervalBuilder(memory.DefaultAllocator)
+	defer months.Release()
+	months.Append(-7)
+
+	for _, tc := range []struct {
+		bldr array.Builder
+		want Interval
+	}{
+		{mdn, Interval{Months: 14, Days: -3, Micros: -1}},
+		{dayTime, Interval{Days: 2, Micros: -1_500_000}},
+		{months, Interval{Months: -7}},
+	} {
+		arr := tc.bldr.NewArray()
+		vec := NewMemVector(arr.DataType(), 2048)
+		if err := Convert(arr, vec, 0, 1); err != nil {
+			t.Fatalf("%s: Convert: %v", arr.DataType(), err)
+		}
+		if got := memSlice[Interval](vec, 1)[0]; got != tc.want {
+			t.Errorf("%s = %+v, want %+v", arr.DataType(), got, tc.want)
+		}
+		arr.Release()
+	}
+}
+
+func TestConvertDecimal128(t *testing.T) {
+	dt := &arrow.Decimal128Type{Precision: 38, Scale: 2}
+	bldr := array.NewDecimal128Builder(memory.DefaultAllocator, dt)
+	defer bldr.Release()
+	bldr.Append(decimal128.FromI64(-12345))
+	arr := bldr.NewArray()
+	defer arr.Release()
+
+	vec := NewMemVector(dt, 2048)
+	if err := Convert(arr, vec, 0, 1); err != nil {
+		t.Fatalf("Convert: %v", err)
+	}
+	got := memSlice[Hugeint](vec, 1)[0]
+	if got.Upper != -1 || int64(got.Lower) != -12345 {
+		t.Errorf("hugeint = %+v, want -12345", got)
+	}
+}
+
+// wideDecimals builds a DECIMAL(50, 10) array from decimal strings of unscaled
+// values, "" being NULL.
+func wideDecimals(t *testing.T, values ...string) arrow.Array {
+	t.Helper()
+	bldr := array.NewDecimal256Builder(memory.DefaultAllocator, &arrow.Decimal256Type{Precision: 50, Scale: 10})
+	defer bldr.Release()
+	for _, v := range values {
+		if v == "" {
+			bldr.AppendNull()
+			continue
+		}
+		n, ok := new(big.Int).SetString(v, 10)
+		if !ok {
+			t.Fatalf("bad test value %q", v)
+		}
+		bldr.Append(decimal256.FromBigInt(n))
+	}
+	return bldr.NewArray()
+}
+
+func TestConvertDecimal256Wide(t *testing.T) {
+	big40 := "1" + strings.Repeat("0", 40)
+	arr := wideDecimals(t, "-12345678901234567890123", "", "7")
+	defer arr.Release()
+
+	vec := NewMemVector(arr.DataType(), 2048)
+	if err := Convert(arr, vec, 0, arr.Len()); err != nil {
+		t.Fatalf("Convert: %v", err)
+	}
+	got := memSlice[Hugeint](vec, 3)
+	want, _ := new(big.Int).SetString("-12345678901234567890123", 10)
+	if n := decimal128.New(got[0].Upper, got[0].Lower).BigInt(); n.Cmp(want) != 0 {
+		t.Errorf("row 0 = %s, want %s", n, want)
+	}
+	if got[2] != (Hugeint{Lower: 7}) {
+		t.Errorf("row 2 = %+v, want 7", got[2])
+	}
+
+	// Values over 38 digits fail the scan instead of wrapping, unless NULL
+	overflow := wideDecimals(t, "1", big40)
+	defer overflow.Release()
+	vec.Reset()
+	if err := Convert(overflow, vec, 0, 2); err == nil || !strings.Contains(err.Error(), "1000000000000000000000000000000.0000000000") {
+		t.Errorf("Convert(overflow) error = %v, want one naming the value", err)
+	}
+}
+
+func TestConvertDecimal256Fallbacks(t *testing.T) {
+	arr := wideDecimals(t, "-15", "", "1"+strings.Repeat("0", 45))
+	defer arr.Release()
+
+	vec := Options{WideDecimals: DecimalVarchar}.NewMemVector(arr.DataType(), 2048)
+	if err := (Options{WideDecimals: DecimalVarchar}).Convert(arr, vec, 0, arr.Len()); err != nil {
+		t.Fatalf("Convert(varchar): %v", err)
+	}
+	if got := vec.String(0); got != "-0.0000000015" {
+		t.Errorf("row 0 = %q, want -0.0000000015", got)
+	}
+	if want := "1" + strings.Repeat("0", 35) + ".0000000000"; vec.String(2) != want {
+		t.Errorf("row 2 = %q, want %q", vec.String(2), want)
+	}
+
+	vec = Options{WideDecimals: DecimalDouble}.NewMemVector(arr.DataType(), 2048)
+	if err := (Options{WideDecimals: DecimalDouble}).Convert(arr, vec, 0, arr.Len()); err != nil {
+		t.Fatalf("Convert(double): %v", err)
+	}
+	got := memSlice[float64](vec, 3)
+	if got[0] != -1.5e-9 || math.Abs(got[2]/1e35-1) > 1e-15 {
+		t.Errorf("doubles = %v, want [-1.5e-09 _ 1e+35]", got)
+	}
+}
+
+func TestConvertDecimalNegativeScale(t *testing.T) {
+	// DECIMAL(5, -2) is DuckDB DECIMAL(7, 0), stored as INT32
+	dt := &arrow.Decimal128Type{Precision: 5, Scale: -2}
+	bldr := array.NewDecimal128Builder(memory.DefaultAllocator, dt)
+	defer bldr.Release()
+	bldr.Append(decimal128.FromI64(-12345))
+	bldr.Append(decimal128.FromI64(7))
+	arr := bldr.NewArray()
+	defer arr.Release()
+
+	if width, scale, ok := (Options{}).Decimal(dt); width != 7 || scale != 0 || !ok {
+		t.Fatalf("Decimal = (%d, %d, %v), want (7, 0, true)", width, scale, ok)
+	}
+	vec := NewMemVector(dt, 2048)
+	if err := Convert(arr, vec, 0, 2); err != nil {
+		t.Fatalf("Convert: %v", err)
+	}
+	if got := memSlice[int32](vec, 2); got[0] != -1234500 || got[1] != 700 {
+		t.Errorf("values = %v, want [-1234500 700]", got)
+	}
+}
+
+func TestParseDecimalMode(t *testing.T) {
+	for _, mode := range []DecimalMode{DecimalChecked, DecimalDouble, DecimalVarchar} {
+		if got, err := ParseDecimalMode(strings.ToUpper(mode.String())); err != nil || got != mode {
+			t.Errorf("ParseDecimalMode(%q) = %v, %v", mode, got, err)
+		}
+	}
+	if _, err := ParseDecimalMode("float"); err == nil {
+		t.Error("ParseDecimalMode(float) succeeded")
+	}
+}
+
+func TestConvertList(t *testing.T) {
+	bldr := array.NewListBuilder(memory.DefaultAllocator, arrow.PrimitiveTypes.Int32)
+	defer bldr.Release()
+	values := bldr.ValueBuilder().(*array.Int32Builder)
+
+	bldr.Append(true) // [1, 2]
+	values.AppendValues([]int32{1, 2}, nil)
+	bldr.AppendNull()
+	bldr.Append(true) // [3]
+	values.Append(3)
+	bldr.Append(true) // [4, 5, 6]
+	values.AppendValues([]int32{4, 5, 6}, nil)
+	arr := bldr.NewArray()
+	defer arr.Release()
+
+	// Convert the last three rows so child offsets must be rebased to zero
+	vec := NewMemVector(arr.DataType(), 2048)
+	if err := Convert(arr, vec, 1, 3); err != nil {
+		t.Fatalf("Convert: %v", err)
+	}
+
+	if !vec.IsNull(0) {
+		t.Error("row 0 should be NULL")
+	}
+	entries := memSlice[ListEntry](vec, 3)
+	if entries[1] != (ListEntry{Offset: 0, Length: 1}) || entries[2] != (ListEntry{Offset: 1, Length: 3}) {
+		t.Errorf("entries = %+v, want [_ {0 1} {1 3}]", entries)
+	}
+	if vec.ListSize() != 4 {
+		t.Errorf("list size = %d, want 4", vec.ListSize())
+	}
+	child := vec.ListChild().(*MemVector)
+	if got := memSlice[int32](child, 4); got[0] != 3 || got[3] != 6 {
+		t.Errorf("child values = %v, want [3 4 5 6]", got)
+	}
+}
+
+func TestConvertListNullWithValues(t *testing.T) {
+	// Arrow allows a NULL list to own child values; the rows after it must
+	// still point at their own
+	values := array.NewInt32Builder(memory.DefaultAllocator)
+	defer values.Release()
+	values.AppendValues([]int32{1, 2, 3, 4}, nil)
+	child := values.NewArray()
+	defer child.Release()
+	offsets := memory.NewBufferBytes(arrow.Int32Traits.CastToBytes([]int32{0, 1, 3, 4}))
+	validity := memory.NewBufferBytes([]byte{0b101})
+	data := array.NewData(arrow.ListOf(arrow.PrimitiveTypes.Int32), 3,
+		[]*memory.Buffer{validity, offsets}, []arrow.ArrayData{child.Data()}, 1, 0)
+	defer data.Release()
+	arr := array.NewListData(data)
+	defer arr.Release()
+
+	vec := NewMemVector(arr.DataType(), 2048)
+	if err := Convert(arr, vec, 0, 3); err != nil {
+		t.Fatalf("Convert: %v", err)
+	}
+	entry := memSlice[ListEntry](vec, 3)[2]
+	if got := memSlice[int32](vec.children[0], 4)[entry.Offset]; entry.Length != 1 || got != 4 {
+		t.Errorf("row 2 = %+v -> %d, want one element 4", entry, got)
+	}
+	if !vec.IsNull(1) {
+		t.Error("row 1 should be NULL")
+	}
+}
+
+func TestConvertStruct(t *testing.T) {
+	dt := arrow.StructOf(
+		arrow.Field{Name: "id", Type: arrow.PrimitiveTypes.Int64},
+		arrow.Field{Name: "name", Type: arrow.BinaryTypes.String, Nullable: true},
+	)
+	bldr := array.NewStructBuilder(memory.DefaultAllocator, dt)
+	defer bldr.Release()
+	bldr.Append(true)
+	bldr.FieldBuilder(0).(*array.Int64Builder).Append(7)
+	bldr.FieldBuilder(1).(*array.StringBuilder).Append("seven")
+	bldr.AppendNull()
+	arr := bldr.NewArray()
+	defer arr.Release()
+
+	vec := NewMemVector(dt, 2048)
+	if err := Convert(arr, vec, 0, 2); err != nil {
+		t.Fatalf("Convert: %v", err)
+	}
+
+	if vec.IsNull(0) || !vec.IsNull(1) {
+		t.Error("expected only row 1 to be NULL")
+	}
+	if got := memSlice[int64](vec.StructChild(0).(*MemVector), 1)[0]; got != 7 {
+		t.Errorf("id = %d, want 7", got)
+	}
+	if got := vec.StructChild(1).(*MemVector).String(0); got != "seven" {
+		t.Errorf("name = %q, want %q", got, "seven")
+	}
+}
+
+func TestConvertMap(t *testing.T) {
+	dt := arrow.MapOf(arrow.BinaryTypes.String, arrow.PrimitiveTypes.Int64)
+	bldr := array.NewMapBuilderWithType(memory.DefaultAllocator, dt)
+	defer bldr.Release()
+	keys := bldr.KeyBuilder().(*array.StringBuilder)
+	items := bldr.ItemBuilder().(*array.Int64Builder)
+
+	bldr.Append(true)
+	keys.AppendValues([]string{"a", "b"}, nil)
+	items.AppendValues([]int64{1, 2}, nil)
+	arr := bldr.NewArray()
+	defer arr.Release()
+
+	vec := NewMemVector(dt, 2048)
+	if err := Convert(arr, vec, 0, 1); err != nil {
+		t.Fatalf("Convert: %v", err)
+	}
+
+	entries := vec.ListChild().(*MemVector)
+	if got := entries.StructChild(0).(*MemVector).String(1); got != "b" {
+		t.Errorf("key[1] = %q, want %q", got, "b")
+	}
+	if got := memSlice[int64](entries.StructChild(1).(*MemVector), 2); got[1] != 2 {
+		t.Errorf("value[1] = %d, want 2", got[1])
+	}
+}
+
+func TestConvertGeneratedTypes(t *testing.T) {
+	// Every type exercised by the benchmarks must convert without error
+	for _, bt := range benchTypes() {
+		t.Run(bt.name, func(t *testing.T) {
+			arr := arrowgen.Array(bt.typ, 3000, arrowgen.Options{NullFraction: 0.1, StringLen: 16, ListLen: 3}, 1)
+			defer arr.Release()
+
+			vec := NewMemVector(bt.typ, 2048)
+			for offset := 0; offset < arr.Len(); offset += 2048 {
+				vec.Reset()
+				count := min(2048, arr.Len()-offset)
+				if err := Convert(arr, vec, offset, count); err != nil {
+					t.Fatalf("Convert at offset %d: %v", offset, err)
+				}
+			}
+		})
+	}
+}
+
+func TestConvertValidityUnaligned(t *testing.T) {
+	const n = 300
+	isNull := func(i int) bool { return i%3 == 0 || i%64 == 63 }
+	bldr := array.NewStringBuilder(memory.DefaultAllocator)
+	defer bldr.Release()
+	for i := 0; i < n; i++ {
+		if isNull(i) {
+			bldr.AppendNull()
+		} else {
+			bldr.Append(fmt.Sprintf("row %d", i))
+		}
+	}
+	full := bldr.NewArray()
+	defer full.Release()
+	// A sliced array has a non-zero data offset, so bitmap reads start mid-byte
+	arr := array.NewSlice(full, 5, n)
+	defer arr.Release()
+
+	const offset, count = 7, 150
+	vec := NewMemVector(arr.DataType(), 2048)
+	if err := Convert(arr, vec, offset, count); err != nil {
+		t.Fatalf("Convert: %v", err)
+	}
+	for i := 0; i < count; i++ {
+		src := 5 + offset + i
+		if vec.IsNull(i) != isNull(src) {
+			t.Fatalf("row %d: IsNull = %v, want %v", i, vec.IsNull(i), isNull(src))
+		}
+		if want := fmt.Sprintf("row %d", src); !isNull(src) && vec.String(i) != want {
+			t.Fatalf("row %d = %q, want %q", i, vec.String(i), want)
+		}
+	}
+}
+
+func TestConvertNullArray(t *testing.T) {
+	arr := array.NewNull(70)
+	defer arr.Release()
+	vec := NewMemVector(arrow.BinaryTypes.String, 2048)
+	if err := Convert(arr, vec, 0, arr.Len()); err != nil {
+		t.Fatalf("Convert: %v", err)
+	}
+	for i := 0; i < arr.Len(); i++ {
+		if !vec.IsNull(i) {
+			t.Fatalf("row %d should be NULL", i)
+		}
+	}
+}
+
+func TestLoadBits(t *testing.T) {
+	bitmap := []byte{0b10110001, 0xFF, 0, 0, 0, 0, 0, 0, 0b00000101}
+	tests := []struct {
+		pos  int
+		want uint64
+	}{
+		{0, 0x00000000_0000FFB1},
+		{4, 0x50000000_00000FFB},
+		// Bits past the end read as valid
+		{8, 0x05000000_000000FF},
+		{72, ^uint64(0)},
+	}
+	for _, tt := range tests {
+		if got := loadBits(bitmap, tt.pos); got != tt.want {
+			t.Errorf("loadBits(%d) = %#x, want %#x", tt.pos, got, tt.want)
+		}
+	}
+}
+
+func TestConvertFixedSizeList(t *testing.T) {
+	dt := arrow.FixedSizeListOf(3, arrow.PrimitiveTypes.Int32)
+	bldr := array.NewFixedSizeListBuilder(memory.DefaultAllocator, 3, arrow.PrimitiveTypes.Int32)
+	defer bldr.Release()
+	values := bldr.ValueBuilder().(*array.Int32Builder)
+	for row := 0; row < 4; row++ {
+		if row == 2 {
+			bldr.AppendNull()
+			continue
+		}
+		bldr.Append(true)
+		values.AppendValues([]int32{int32(row * 10), int32(row*10 + 1)}, nil)
+		values.AppendNull()
+	}
+	full := bldr.NewArray()
+	defer full.Release()
+	// Slice so the child start depends on the parent's data offset
+	arr := array.NewSlice(full, 1, 4)
+	defer arr.Release()
+
+	vec := NewMemVector(dt, 2048)
+	if err := Convert(arr, vec, 0, arr.Len()); err != nil {
+		t.Fatalf("Convert: %v", err)
+	}
+	if vec.IsNull(0) || !vec.IsNull(1) || vec.IsNull(2) {
+		t.Error("only row 1 (source row 2) should be NULL")
+	}
+	child := vec.ArrayChild().(*MemVector)
+	got := memSlice[int32](child, 9)
+	for idx, want := range map[int]int32{0: 10, 1: 11, 6: 30, 7: 31} {
+		if got[idx] != want {
+			t.Errorf("child[%d] = %d, want %d", idx, got[idx], want)
+		}
+	}
+	if !child.IsNull(2) || !child.IsNull(8) || child.IsNull(6) {
+		t.Error("child NULLs should follow the Arrow child validity")
+	}
+}
+
+func TestConvertZeroSizeFixedSizeList(t *testing.T) {
+	// DuckDB has no ARRAY of size 0, so fixed_size_list<int32, 0> converts to LIST
+	dt := arrow.FixedSizeListOf(0, arrow.PrimitiveTypes.Int32)
+	if NativeArray(dt) {
+		t.Fatal("NativeArray should reject size 0")
+	}
+	if !NativeArray(arrow.FixedSizeListOf(MaxArraySize, arrow.PrimitiveTypes.Int32)) || NativeArray(arrow.FixedSizeListOf(MaxArraySize+1, arrow.PrimitiveTypes.Int32)) {
+		t.Error("NativeArray should accept sizes up to MaxArraySize only")
+	}
+
+	bldr := array.NewFixedSizeListBuilder(memory.DefaultAllocator, 0, arrow.PrimitiveTypes.Int32)
+	defer bldr.Release()
+	bldr.Append(true)
+	bldr.AppendNull()
+	bldr.Append(true)
+	arr := bldr.NewArray()
+	defer arr.Release()
+
+	vec := NewMemVector(dt, 2048)
+	if _, isList := vec.typ.(*arrow.ListType); !isList {
+		t.Fatalf("vector type = %s, want a LIST layout", vec.typ)
+	}
+	if err := Convert(arr, vec, 0, arr.Len()); err != nil {
+		t.Fatalf("Convert: %v", err)
+	}
+	if vec.IsNull(0) || !vec.IsNull(1) || vec.IsNull(2) {
+		t.Error("only row 1 should be NULL")
+	}
+	for i, entry := range memSlice[ListEntry](vec, 3) {
+		if entry.Length != 0 {
+			t.Errorf("row %d has %d elements, want 0", i, entry.Length)
+		}
+	}
+}
+
+func TestConvertStringView(t *testing.T) {
+	bldr := array.NewStringViewBuilder(memory.DefaultAllocator)
+	defer bldr.Release()
+	values := []string{"skip", "short", "exactly12byt", "a string longer than twelve bytes", "", "thirteen byte"}
+	bldr.AppendValues(values, nil)
+	bldr.AppendNull()
+	full := bldr.NewArray()
+	defer full.Release()
+	arr := array.NewSlice(full, 1, full.Len())
+	defer arr.Release()
+
+	vec := NewMemVector(arr.DataType(), 2048)
+	if err := Convert(arr, vec, 0, arr.Len()); err != nil {
+		t.Fatalf("Convert: %v", err)
+	}
+	for i, want := range values[1:] {
+		if got := vec.String(i); got != want {
+			t.Errorf("row %d = %q, want %q", i, got, want)
+		}
+	}
+	if !vec.IsNull(5) {
+		t.Error("row 5 should be NULL")
+	}
+}
+
+func TestConvertListView(t *testing.T) {
+	values := array.NewInt64Builder(memory.DefaultAllocator)
+	defer values.Release()
+	values.AppendValues([]int64{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}, nil)
+	child := values.NewArray()
+	defer child.Release()
+
+	// Out of order and overlapping rows: [6 7 8], [0 1], [], NULL, [1 2 3]
+	offsets := []int32{6, 0, 0, 0, 1}
+	sizes := []int32{3, 2, 0, 0, 3}
+	data := array.NewData(arrow.ListViewOf(arrow.PrimitiveTypes.Int64), 5,
+		[]*memory.Buffer{
+			memory.NewBufferBytes([]byte{0b10111}),
+			memory.NewBufferBytes(arrow.Int32Traits.CastToBytes(offsets)),
+			memory.NewBufferBytes(arrow.Int32Traits.CastToBytes(sizes)),
+		},
+		[]arrow.ArrayData{child.Data()}, 1, 0)
+	defer data.Release()
+	arr := array.MakeFromData(data)
+	defer arr.Release()
+
+	vec := NewMemVector(arr.DataType(), 2048)
+	if err := Convert(arr, vec, 0, arr.Len()); err != nil {
+		t.Fatalf("Convert: %v", err)
+	}
+	if !vec.IsNull(3) || vec.IsNull(2) {
+		t.Error("only row 3 should be NULL")
+	}
+	elems := memSlice[int64](vec.ListChild().(*MemVector), int(vec.ListSize()))
+	entries := memSlice[ListEntry](vec, 5)
+	want := [][]int64{{6, 7, 8}, {0, 1}, {}, {}, {1, 2, 3}}
+	for i, w := range want {
+		e := entries[i]
+		got := elems[e.Offset : e.Offset+e.Length]
+		if fmt.Sprint(got) != fmt.Sprint(w) {
+			t.Errorf("row %d = %v, want %v", i, got, w)
+		}
+	}
+	if vec.ListSize() != 9 {
+		t.Errorf("child size = %d, want 9 (elements 0 through 8)", vec.ListSize())
+	}
+}
+
+// runEndEncoded builds a run-end encoded array from run ends and values.
+func runEndEncoded(t *testing.T, runEnds []int32, values arrow.Array) *array.RunEndEncoded {
+	t.Helper()
+	bldr := array.NewInt32Builder(memory.DefaultAllocator)
+	defer bldr.Release()
+	bldr.AppendValues(runEnds, nil)
+	ends := bldr.NewArray()
+	defer ends.Release()
+	return array.NewRunEndEncodedArray(ends, values, int(runEnds[len(runEnds)-1]), 0)
+}
+
+func TestConvertRunEndStrings(t *testing.T) {
+	long := "a string longer than twelve bytes"
+	bldr := array.NewStringBuilder(memory.DefaultAllocator)
+	defer bldr.Release()
+	bldr.AppendValues([]string{"first", "short"}, nil)
+	bldr.AppendNull()
+	bldr.Append(long)
+	values := bldr.NewArray()
+	defer values.Release()
+
+	// first x2, short x3, NULL x2, long x4
+	full := runEndEncoded(t, []int32{2, 5, 7, 11}, values)
+	defer full.Release()
+	// Slice past the first run and convert from inside the second
+	arr := array.NewSlice(full, 2, 11)
+	defer arr.Release()
+
+	vec := NewMemVector(arr.DataType(), 2048)
+	if err := Convert(arr, vec, 1, 8); err != nil {
+		t.Fatalf("Convert: %v", err)
+	}
+	want := []string{"short", "short", "", "", long, long, long, long}
+	for i, w := range want {
+		if null := i == 2 || i == 3; vec.IsNull(i) != null {
+			t.Errorf("row %d: IsNull = %v, want %v", i, vec.IsNull(i), null)
+			continue
+		}
+		if got := vec.String(i); !vec.IsNull(i) && got != w {
+			t.Errorf("row %d = %q, want %q", i, got, w)
+		}
+	}
+	if len(vec.long) != 1 {
+		t.Errorf("long run stored %d times, want once", len(vec.long))
+	}
+}
+
+func TestConvertRunEndInt64(t *testing.T) {
+	bldr := array.NewInt64Builder(memory.DefaultAllocator)
+	defer bldr.Release()
+	bldr.AppendValues([]int64{7, -1}, nil)
+	values := bldr.NewArray()
+	defer values.Release()
+	arr := runEndEncoded(t, []int32{3000, 3001}, values)
+	defer arr.Release()
+
+	// Two DuckDB-sized chunks: one inside the first run, one spanning both
+	vec := NewMemVector(arr.DataType(), 2048)
+	if err := Convert(arr, vec, 0, 2048); err != nil {
+		t.Fatalf("Convert: %v", err)
+	}
+	for i, v := range memSlice[int64](vec, 2048) {
+		if v != 7 {
+			t.Fatalf("chunk 1 row %d = %d, want 7", i, v)
+		}
+	}
+	vec.Reset()
+	if err := Convert(arr, vec, 2048, 953); err != nil {
+		t.Fatalf("Convert: %v", err)
+	}
+	got := memSlice[int64](vec, 953)
+	if got[0] != 7 || got[951] != 7 || got[952] != -1 {
+		t.Errorf("chunk 2 = [%d ... %d %d], want [7 ... 7 -1]", got[0], got[951], got[952])
+	}
+}
+
+func TestConvertSparseUnion(t *testing.T) {
+	typeIDs := array.NewInt8Builder(memory.DefaultAllocator)
+	defer typeIDs.Release()
+	typeIDs.AppendValues([]int8{0, 1, 1, 0}, nil)
+	ints := array.NewInt64Builder(memory.DefaultAllocator)
+	defer ints.Release()
+	ints.AppendValues([]int64{10, 0, 0, 40}, nil)
+	strs := array.NewStringBuilder(memory.DefaultAllocator)
+	defer strs.Release()
+	strs.AppendValues([]string{"", "a string over twelve bytes", "", ""}, []bool{true, true, false, true})
+
+	ids, intArr, strArr := typeIDs.NewArray(), ints.NewArray(), strs.NewArray()
+	defer ids.Release()
+	defer intArr.Release()
+	defer strArr.Release()
+	arr, err := array.NewSparseUnionFromArrays(ids, []arrow.Array{intArr, strArr})
+	if err != nil {
+		t.Fatal(err)
+	}
+	defer arr.Release()
+
+	vec := NewMemVector(arr.DataType(), 2048)
+	if err := Convert(arr, vec, 0, arr.Len()); err != nil {
+		t.Fatalf("Convert: %v", err)
+	}
+	if got := memSlice[uint8](vec.children[0], 4); fmt.Sprint(got) != "[0 1 1 0]" {
+		t.Errorf("tags = %v, want [0 1 1 0]", got)
+	}
+	intVec, strVec := vec.children[1], vec.children[2]
+	if got := memSlice[int64](intVec, 4); got[0] != 10 || got[3] != 40 {
+		t.Errorf("int member = %v, want 10 at row 0 and 40 at row 3", got)
+	}
+	if got := strVec.String(1); got != "a string over twelve bytes" {
+		t.Errorf("string member row 1 = %q", got)
+	}
+	// Members are NULL outside their rows; the union is NULL where its member is
+	for i, want := range []bool{false, true, true, false} {
+		if intVec.IsNull(i) != want {
+			t.Errorf("int member row %d null = %v, want %v", i, intVec.IsNull(i), want)
+		}
+	}
+	for i, want := range []bool{false, false, true, false} {
+		if vec.IsNull(i) != want {
+			t.Errorf("union row %d null = %v, want %v", i, vec.IsNull(i), want)
+		}
+	}
+}
+
+func TestConvertDenseUnion(t *testing.T) {
+	typeIDs := array.NewInt8Builder(memory.DefaultAllocator)
+	defer typeIDs.Release()
+	typeIDs.AppendValues([]int8{1, 0, 1, 1, 0}, nil)
+	// Offsets within a member need not be in row order
+	offsets := array.NewInt32Builder(memory.DefaultAllocator)
+	defer offsets.Release()
+	offsets.AppendValues([]int32{2, 1, 0, 1, 0}, nil)
+	ints := array.NewInt32Builder(memory.DefaultAllocator)
+	defer ints.Release()
+	ints.AppendValues([]int32{7, 8}, nil)
+	strs := array.NewStringBuilder(memory.DefaultAllocator)
+	defer strs.Release()
+	strs.AppendValues([]string{"short", "", "a string over twelve bytes"}, []bool{true, false, true})
+
+	ids, offs, intArr, strArr := typeIDs.NewArray(), offsets.NewArray(), ints.NewArray(), strs.NewArray()
+	defer ids.Release()
+	defer offs.Release()
+	defer intArr.Release()
+	defer strArr.Release()
+	arr, err := array.NewDenseUnionFromArrays(ids, offs, []arrow.Array{intArr, strArr})
+	if err != nil {
+		t.Fatal(err)
+	}
+	defer arr.Release()
+
+	// Start at row 1 so the chunk does not begin at the union's first value
+	vec := NewMemVector(arr.DataType(), 2048)
+	if err := Convert(arr, vec, 1, 4); err != nil {
+		t.Fatalf("Convert: %v", err)
+	}
+	if got := memSlice[uint8](vec.children[0], 4); fmt.Sprint(got) != "[0 1 1 0]" {
+		t.Errorf("tags = %v, want [0 1 1 0]", got)
+	}
+	intVec, strVec := vec.children[1], vec.children[2]
+	if got := memSlice[int32](intVec, 4); got[0] != 8 || got[3] != 7 {
+		t.Errorf("int member = %v, want 8 at row 0 and 7 at row 3", got)
+	}
+	if got := strVec.String(1); got != "short" {
+		t.Errorf("string member row 1 = %q, want short", got)
+	}
+	if !vec.IsNull(2) || !strVec.IsNull(2) {
+		t.Error("row 2 selects a NULL string and should be NULL")
+	}
+	if !strVec.IsNull(0) || strVec.IsNull(1) {
+		t.Error("string member should only be valid in rows selecting it")
+	}
+}
+
+func TestNativeUnion(t *testing.T) {
+	nested := []arrow.DataType{arrow.PrimitiveTypes.Int64, arrow.ListOf(arrow.PrimitiveTypes.Int64)}
+	if !NativeUnion(arrow.SparseUnionOf([]arrow.Field{{Name: "a", Type: nested[0]}, {Name: "b", Type: nested[1]}}, []arrow.UnionTypeCode{0, 1})) {
+		t.Error("sparse unions with nested members should be native")
+	}
+	if NativeUnion(arrow.DenseUnionOf([]arrow.Field{{Name: "a", Type: nested[0]}, {Name: "b", Type: nested[1]}}, []arrow.UnionTypeCode{0, 1})) {
+		t.Error("dense unions with nested members should not be native")
+	}
+}
+
+// uuidStorage builds 16-byte FixedSizeBinary storage holding one UUID and a NULL.
+func uuidStorage(t *testing.T) arrow.Array {
+	t.Helper()
+	bldr := array.NewFixedSizeBinaryBuilder(memory.DefaultAllocator, &arrow.FixedSizeBinaryType{ByteWidth: 16})
+	defer bldr.Release()
+	bldr.Append([]byte{0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff})
+	bldr.AppendNull()
+	return bldr.NewArray()
+}
+
+// checkUUIDs checks vec holds the values of uuidStorage as DuckDB UUIDs.
+func checkUUIDs(t *testing.T, vec *MemVector) {
+	t.Helper()
+	// DuckDB flips the top bit so UUIDs sort like their text
+	want := Hugeint{Lower: 0x8899aabbccddeeff, Upper: -0x7feeddccbbaa9989}
+	if got := memSlice[Hugeint](vec, 1)[0]; got != want {
+		t.Errorf("uuid = %+v, want %+v", got, want)
+	}
+	if !vec.IsNull(1) {
+		t.Error("row 1 should be NULL")
+	}
+}
+
+func TestConvertUUIDExtension(t *testing.T) {
+	storage := uuidStorage(t)
+	defer storage.Release()
+	arr := array.NewExtensionArrayWithStorage(extensions.NewUUIDType(), storage)
+	defer arr.Release()
+
+	vec := NewMemVector(arr.DataType(), 2048)
+	if vec.elemSize != 16 || (Options{}).storesStrings(arr.DataType()) {
+		t.Fatalf("UUID vector has %d-byte values, want 16-byte HUGEINTs", vec.elemSize)
+	}
+	if err := Convert(arr, vec, 0, arr.Len()); err != nil {
+		t.Fatalf("Convert: %v", err)
+	}
+	checkUUIDs(t, vec)
+}
+
+func TestConvertFieldMetadataExtension(t *testing.T) {
+	storage := uuidStorage(t)
+	defer storage.Release()
+	field := arrow.Field{Name: "id", Type: storage.DataType(),
+		Metadata: arrow.NewMetadata([]string{"ARROW:extension:name"}, []string{"arrow.uuid"})}
+
+	vec := NewMemVector(fieldLayout(field), 2048)
+	if err := (Options{}).ConvertField(field, storage, vec, 0, storage.Len()); err != nil {
+		t.Fatalf("ConvertField: %v", err)
+	}
+	checkUUIDs(t, vec)
+
+	// Struct fields keep their metadata, so nested UUIDs are mapped too
+	structArr, err := array.NewStructArrayWithFields([]arrow.Array{storage}, []arrow.Field{field})
+	if err != nil {
+		t.Fatal(err)
+	}
+	defer structArr.Release()
+	structVec := NewMemVector(structArr.DataType(), 2048)
+	if err := Convert(structArr, structVec, 0, structArr.Len()); err != nil {
+		t.Fatalf("Convert: %v", err)
+	}
+	checkUUIDs(t, structVec.children[0])
+}
+
+func TestExtensionOf(t *testing.T) {
+	named := func(name string) arrow.Metadata {
+		return arrow.NewMetadata([]string{"ARROW:extension:name"}, []string{name})
+	}
+	tests := []struct {
+		name    string
+		typ     arrow.DataType
+		md      arrow.Metadata
+		want    Target
+		alias   string
+		applies bool
+	}{
+		{"json", arrow.BinaryTypes.String, named("arrow.json"), TargetStorage, "JSON", true},
+		{"json over int64", arrow.PrimitiveTypes.Int64, named("arrow.json"), 0, "", false},
+		{"wkb", arrow.BinaryTypes.LargeBinary, named("geoarrow.wkb"), TargetStorage, "WKB_BLOB", true},
+		{"bool8", arrow.PrimitiveTypes.Int8, named("arrow.bool8"), TargetBoolean, "", true},
+		{"uuid of 8 bytes", &arrow.FixedSizeBinaryType{ByteWidth: 8}, named("arrow.uuid"), 0, "", false},
+		{"unknown", arrow.BinaryTypes.String, named("acme.unknown"), 0, "", false},
+		{"no metadata", arrow.BinaryTypes.String, arrow.Metadata{}, 0, "", false},
+		{"arrow-go type", extensions.NewUUIDType(), arrow.Metadata{}, TargetUUID, "", true},
+	}
+	for _, tt := range tests {
+		ext, _, ok := ExtensionOf(tt.typ, tt.md)
+		if ok != tt.applies || ext.Target != tt.want || ext.Alias != tt.alias {
+			t.Errorf("%s: got %+v ok=%v, want target %d alias %q ok=%v", tt.name, ext, ok, tt.want, tt.alias, tt.applies)
+		}
+	}
+}
+
+func TestConvertRegisteredExtension(t *testing.T) {
+	RegisterExtension(Extension{Name: "test.flag", Target: TargetBoolean})
+	t.Cleanup(func() { delete(extensionRegistry.byName, "test.flag") })
+
+	bldr := array.NewUint8Builder(memory.DefaultAllocator)
+	defer bldr.Release()
+	bldr.AppendValues([]uint8{0, 2, 1, 0}, []bool{true, true, true, false})
+	arr := bldr.NewArray()
+	defer arr.Release()
+	field := arrow.Field{Name: "flag", Type: arr.DataType(),
+		Metadata: arrow.NewMetadata([]string{"ARROW:extension:name"}, []string{"test.flag"})}
+
+	vec := NewMemVector(fieldLayout(field), 2048)
+	if err := (Options{}).ConvertField(field, arr, vec, 0, arr.Len()); err != nil {
+		t.Fatalf("ConvertField: %v", err)
+	}
+	if got := memSlice[uint8](vec, 3); fmt.Sprint(got) != "[0 1 1]" {
+		t.Errorf("flags = %v, want [0 1 1]", got)
+	}
+	if !vec.IsNull(3) {
+		t.Error("row 3 should be NULL")
+	}
+}
@@ -0,0 +1,284 @@
+package convert
+
+import (
+	"fmt"
+	"math"
+	"math/big"
+	"math/bits"
+	"strings"
+	"unsafe"
+
+	"github.com/apache/arrow-go/v18/arrow"
+)
+
+// maxDecimalWidth is the widest DuckDB DECIMAL, stored as a HUGEINT.
+const maxDecimalWidth = 38
+
+// DecimalMode selects the DuckDB type of decimals wider than DuckDB's DECIMAL.
+type DecimalMode int32
+
+const (
+	// DecimalChecked maps wide decimals to DECIMAL(38, scale) and fails the
+	// scan on values with more than 38 digits.
+	DecimalChecked DecimalMode = iota
+	// DecimalDouble maps wide decimals to DOUBLE, the nearest value.
+	DecimalDouble
+	// DecimalVarchar maps wide decimals to VARCHAR holding the exact value.
+	DecimalVarchar
+)
+
+var decimalModeNames = []string{"decimal", "double", "varchar"}
+
+func (m DecimalMode) String() string {
+	if int(m) < len(decimalModeNames) {
+		return decimalModeNames[m]
+	}
+	return fmt.Sprintf("DecimalMode(%d)", int32(m))
+}
+
+// ParseDecimalMode parses "decimal", "double" or "varchar".
+func ParseDecimalMode(s string) (DecimalMode, error) {
+	for i, name := range decimalModeNames {
+		if strings.EqualFold(s, name) {
+			return DecimalMode(i), nil
+		}
+	}
+	return 0, fmt.Errorf("invalid decimal mode %q (expected decimal, double or varchar)", s)
+}
+
+// decimalPlan describes how the values of an Arrow decimal type become DuckDB
+// DECIMAL(width, scale) values.
+type decimalPlan struct {
+	width, scale int32
+	// rescale is the power of ten values are multiplied by, for negative
+	// Arrow scales, which DuckDB does not have.
+	rescale int32
+	// checked is set when values may have more than width digits.
+	checked bool
+}
+
+// Decimal returns the DuckDB DECIMAL width and scale for Arrow decimal type t,
+// or ok=false if t maps to the WideDecimals fallback type instead.
+func (o Options) Decimal(t arrow.DecimalType) (width, scale int32, ok bool) {
+	p, ok := o.decimalPlan(t)
+	return p.width, p.scale, ok
+}
+
+// decimalType returns t as a DecimalType if it is a Decimal128 or Decimal256,
+// the decimal types converted natively.
+func decimalType(t arrow.DataType) (arrow.DecimalType, bool) {
+	switch t.ID() {
+	case arrow.DECIMAL128, arrow.DECIMAL256:
+		return t.(arrow.DecimalType), true
+	}
+	return nil, false
+}
+
+func (o Options) decimalPlan(t arrow.DecimalType) (decimalPlan, bool) {
+	p := decimalPlan{width: t.GetPrecision(), scale: t.GetScale()}
+	if p.scale < 0 {
+		// DECIMAL(5, -2) holds 7-digit integers
+		p.width -= p.scale
+		p.rescale = -p.scale
+		p.scale = 0
+	}
+	// Arrow allows scale > precision (values below 10^-(scale-precision)); DuckDB doesn't
+	p.width = max(p.width, p.scale)
+	if p.width <= maxDecimalWidth {
+		return p, true
+	}
+	if o.WideDecimals != DecimalChecked || p.scale > maxDecimalWidth {
+		return decimalPlan{}, false
+	}
+	p.width = maxDecimalWidth
+	p.checked = true
+	return p, true
+}
+
+// convertDecimal converts Decimal128 and Decimal256 columns. Values that fit
+// DuckDB's storage width copy their low words; negative scales and wide
+// decimals go through the checked path, and unsupported ones fall back to
+// DOUBLE or VARCHAR.
+func (o Options) convertDecimal(arr arrow.Array, vec Vector, offset, count int) error {
+	t := arr.DataType().(arrow.DecimalType)
+	stride := t.BitWidth() / 64
+	words := decimalWords(arr, stride, offset, count)
+	p, ok := o.decimalPlan(t)
+	switch {
+	case !ok && o.WideDecimals == DecimalDouble:
+		decimalsToDoubles(unsafe.Slice((*float64)(vec.Data()), count), words, stride, t.GetScale())
+		return nil
+	case !ok:
+		decimalsToStrings(arr, vec, words, stride, t.GetScale(), offset)
+		return nil
+	case p.rescale != 0 || p.checked:
+		return checkedDecimals(arr, vec, words, stride, p, offset)
+	}
+
+	// Arrow guarantees values fit the precision, so the low words hold them
+	switch decimalSize(p.width) {
+	case 2:
+		lowDecimals(unsafe.Slice((*int16)(vec.Data()), count), words, stride)
+	case 4:
+		lowDecimals(unsafe.Slice((*int32)(vec.Data()), count), words, stride)
+	case 8:
+		lowDecimals(unsafe.Slice((*int64)(vec.Data()), count), words, stride)
+	default:
+		dst := unsafe.Slice((*Hugeint)(vec.Data()), count)
+		for i := range dst {
+			w := words[i*stride : i*stride+2]
+			dst[i] = Hugeint{Lower: w[0], Upper: int64(w[1])}
+		}
+	}
+	return nil
+}
+
+// decimalWords returns the little-endian 64-bit words of count decimal values
+// starting at offset, stride words per value.
+func decimalWords(arr arrow.Array, stride, offset, count int) []uint64 {
+	buf := arr.Data().Buffers()[1].Bytes()
+	words := unsafe.Slice((*uint64)(unsafe.Pointer(unsafe.SliceData(buf))), len(buf)/8)
+	start := (arr.Data().Offset() + offset) * stride
+	return words[start : start+count*stride]
+}
+
+// lowDecimals stores the low word of each value, truncated to T.
+func lowDecimals[T ~int16 | ~int32 | ~int64](dst []T, words []uint64, stride int) {
+	words = words[:len(dst)*stride]
+	for i := range dst {
+		dst[i] = T(words[i*stride])
+	}
+}
+
+// pow10Huge[n] is 10^n as (low, high) words, for n up to maxDecimalWidth.
+var pow10Huge = func() (p [maxDecimalWidth + 1][2]uint64) {
+	p[0][0] = 1
+	for n := 1; n < len(p); n++ {
+		hi, lo := bits.Mul64(p[n-1][0], 10)
+		p[n] = [2]uint64{lo, p[n-1][1]*10 + hi}
+	}
+	return p
+}()
+
+// checkedDecimals multiplies each value by 10^p.rescale and stores it with
+// DuckDB's storage width for p.width, failing on the first non-NULL value
+// with more than p.width digits. Values are handled as sign and 128-bit
+// magnitude; any magnitude bits above 128 are an overflow.
+func checkedDecimals(arr arrow.Array, vec Vector, words []uint64, stride int, p decimalPlan, offset int) error {
+	limit := pow10Huge[p.width]
+	size := decimalSize(p.width)
+	data := vec.Data()
+	var mag [4]uint64
+	for i := 0; i*stride < len(words); i++ {
+		neg := magnitude(mag[:stride], words[i*stride:i*stride+stride])
+		lo, hi := mag[0], mag[1]
+		overflow := stride == 4 && mag[2]|mag[3] != 0
+		for k := p.rescale; k > 0 && !overflow; k -= 19 {
+			f := pow10Huge[min(k, 19)][0]
+			h0, l0 := bits.Mul64(lo, f)
+			h1, l1 := bits.Mul64(hi, f)
+			var carry uint64
+			hi, carry = bits.Add64(l1, h0, 0)
+			lo = l0
+			overflow = h1|carry != 0
+		}
+		if overflow || hi > limit[1] || hi == limit[1] && lo >= limit[0] {
+			if arr.IsNull(offset + i) {
+				continue
+			}
+			return fmt.Errorf("decimal value %s has more than %d digits (see the wide_decimal setting)",
+				formatDecimal(words[i*stride:i*stride+stride], arr.DataType().(arrow.DecimalType).GetScale()), p.width)
+		}
+		if neg {
+			var borrow uint64
+			lo, borrow = bits.Sub64(0, lo, 0)
+			hi, _ = bits.Sub64(0, hi, borrow)
+		}
+		switch size {
+		case 2:
+			*(*int16)(unsafe.Add(data, i*2)) = int16(lo)
+		case 4:
+			*(*int32)(unsafe.Add(data, i*4)) = int32(lo)
+		case 8:
+			*(*int64)(unsafe.Add(data, i*8)) = int64(lo)
+		default:
+			*(*Hugeint)(unsafe.Add(data, i*16)) = Hugeint{Lower: lo, Upper: int64(hi)}
+		}
+	}
+	return nil
+}
+
+// magnitude stores the absolute value of the two's complement number w in mag
+// and reports whether it was negative.
+func magnitude(mag, w []uint64) bool {
+	neg := int64(w[len(w)-1]) < 0
+	copy(mag, w)
+	if neg {
+		var borrow uint64
+		for j := range mag {
+			mag[j], borrow = bits.Sub64(0, mag[j], borrow)
+		}
+	}
+	return neg
+}
+
+// decimalsToDoubles stores each value divided by 10^scale. Summing the
+// magnitude from its most significant word and dividing each round once, so
+// results can be off from the nearest double in the last bit.
+func decimalsToDoubles(dst []float64, words []uint64, stride int, scale int32) {
+	div := math.Pow10(int(scale))
+	var mag [4]uint64
+	for i := range dst {
+		neg := magnitude(mag[:stride], words[i*stride:i*stride+stride])
+		f := 0.0
+		for j := stride - 1; j >= 0; j-- {
+			f = f*0x1p64 + float64(mag[j])
+		}
+		if neg {
+			f = -f
+		}
+		dst[i] = f / div
+	}
+}
+
+// decimalsToStrings stores the exact decimal text of each non-NULL value.
+func decimalsToStrings(arr arrow.Array, vec Vector, words []uint64, stride int, scale int32, offset int) {
+	for i := 0; i*stride < len(words); i++ {
+		if arr.IsNull(offset + i) {
+			continue
+		}
+		vec.AssignString(i, formatDecimal(words[i*stride:i*stride+stride], scale))
+	}
+}
+
+// formatDecimal formats the two's complement number w divided by 10^scale,
+// without rounding through floating point.
+func formatDecimal(w []uint64, scale int32) string {
+	var mag [4]uint64
+	neg := magnitude(mag[:len(w)], w)
+	n := new(big.Int)
+	for j := len(w) - 1; j >= 0; j-- {
+		n.Lsh(n, 64).Or(n, new(big.Int).SetUint64(mag[j]))
+	}
+	digits := n.String()
+	var sb strings.Builder
+	if neg {
+		sb.WriteByte('-')
+	}
+	switch {
+	case scale <= 0:
+		sb.WriteString(digits)
+		if digits != "0" {
+			sb.WriteString(strings.Repeat("0", int(-scale)))
+		}
+	case len(digits) <= int(scale):
+		sb.WriteString("0.")
+		sb.WriteString(strings.Repeat("0", int(scale)-len(digits)))
+		sb.WriteString(digits)
+	default:
+		sb.WriteString(digits[:len(digits)-int(scale)])
+		sb.WriteByte('.')
+		sb.WriteString(digits[len(digits)-int(scale):])
+	}
+	return sb.String()
+}
@@ -0,0 +1,198 @@
+package convert
+
+import (
+	"encoding/binary"
+	"sync"
+	"unsafe"
+
+	"github.com/apache/arrow-go/v18/arrow"
+	"github.com/apache/arrow-go/v18/arrow/array"
+)
+
+// An Arrow extension type is a storage type plus a name, either carried by an
+// arrow.ExtensionType (names registered with arrow-go) or only by the field
+// metadata. Unmapped extension types convert as their storage type; the
+// registry below maps known names to a DuckDB type with a direct conversion
+// from storage, so a UUID no longer goes through text and a cast in SQL.
+
+// extensionNameKey is the field metadata key naming a field's extension type.
+const extensionNameKey = "ARROW:extension:name"
+
+// Target is the DuckDB type an extension type's values are converted to.
+type Target int
+
+const (
+	// TargetStorage converts values as their storage type.
+	TargetStorage Target = iota
+	// TargetUUID converts 16-byte FixedSizeBinary values to UUID.
+	TargetUUID
+	// TargetBoolean converts 8-bit integer values to BOOLEAN, nonzero being true.
+	TargetBoolean
+)
+
+// Extension maps an Arrow extension type to a DuckDB type.
+type Extension struct {
+	// Name is the extension name, e.g. "arrow.uuid".
+	Name string
+	// Target is the DuckDB type values are converted to.
+	Target Target
+	// Alias names the DuckDB type, e.g. JSON for VARCHAR; empty for none.
+	Alias string
+	// Storage reports whether the mapping applies to storage type t. Nil
+	// accepts every storage type Target can convert; others convert as
+	// their storage type.
+	Storage func(t arrow.DataType) bool
+}
+
+// accepts reports whether ext applies to values of the given storage type.
+func (ext Extension) accepts(storage arrow.DataType) bool {
+	if ext.Storage != nil && !ext.Storage(storage) {
+		return false
+	}
+	switch ext.Target {
+	case TargetUUID:
+		fsb, ok := storage.(*arrow.FixedSizeBinaryType)
+		return ok && fsb.ByteWidth == 16
+	case TargetBoolean:
+		return storage.ID() == arrow.INT8 || storage.ID() == arrow.UINT8
+	}
+	return true
+}
+
+var extensionRegistry = struct {
+	sync.RWMutex
+	byName map[string]Extension
+}{byName: map[string]Extension{}}
+
+// RegisterExtension adds or replaces the mapping for ext.Name. Extensions
+// for a producer's own types are registered from an init function, before
+// any scan binds: a scan must see the same mapping when it declares column
+// types and when it converts values.
+func RegisterExtension(ext Extension) {
+	extensionRegistry.Lock()
+	defer extensionRegistry.Unlock()
+	extensionRegistry.byName[ext.Name] = ext
+}
+
+func init() {
+	RegisterExtension(Extension{Name: "arrow.uuid", Target: TargetUUID})
+	RegisterExtension(Extension{Name: "arrow.bool8", Target: TargetBoolean})
+	// DuckDB's JSON type is VARCHAR under the JSON alias
+	RegisterExtension(Extension{Name: "arrow.json", Alias: "JSON", Storage: isStringType})
+	// Spatial's WKB_BLOB casts to GEOMETRY; GEOMETRY itself is not WKB
+	RegisterExtension(Extension{Name: "geoarrow.wkb", Alias: "WKB_BLOB", Storage: isBinaryType})
+}
+
+func isStringType(t arrow.DataType) bool {
+	switch t.ID() {
+	case arrow.STRING, arrow.LARGE_STRING, arrow.STRING_VIEW:
+		return true
+	}
+	return false
+}
+
+func isBinaryType(t arrow.DataType) bool {
+	switch t.ID() {
+	case arrow.BINARY, arrow.LARGE_BINARY, arrow.BINARY_VIEW:
+		return true
+	}
+	return false
+}
+
+// ExtensionOf returns the mapping for a column of type t with field metadata
+// md, and the storage type its values arrive as. The extension name comes
+// from t if it is an arrow.ExtensionType, otherwise from md. ok is false if
+// no registered mapping applies, and the column converts as storage.
+func ExtensionOf(t arrow.DataType, md arrow.Metadata) (ext Extension, storage arrow.DataType, ok bool) {
+	var name string
+	storage = t
+	if et, isExt := t.(arrow.ExtensionType); isExt {
+		name, storage = et.ExtensionName(), et.StorageType()
+	} else if i := md.FindKey(extensionNameKey); i >= 0 {
+		name = md.Values()[i]
+	} else {
+		return Extension{}, storage, false
+	}
+	extensionRegistry.RLock()
+	ext, ok = extensionRegistry.byName[name]
+	extensionRegistry.RUnlock()
+	if !ok || !ext.accepts(storage) {
+		return Extension{}, storage, false
+	}
+	return ext, storage, true
+}
+
+// fieldLayout returns an Arrow type whose DuckDB vector is laid out like the
+// one field converts to, for sizing vectors.
+func fieldLayout(field arrow.Field) arrow.DataType {
+	ext, storage, ok := ExtensionOf(field.Type, field.Metadata)
+	if fsl, isFSL := storage.(*arrow.FixedSizeListType); isFSL && !NativeArray(fsl) {
+		return arrow.ListOfField(fsl.ElemField())
+	}
+	if !ok {
+		return storage
+	}
+	switch ext.Target {
+	case TargetUUID:
+		// UUID is a HUGEINT, like DECIMAL(38)
+		return &arrow.Decimal128Type{Precision: maxDecimalWidth}
+	case TargetBoolean:
+		return arrow.FixedWidthTypes.Boolean
+	}
+	return storage
+}
+
+// ConvertField is Convert for a column described by field, so extension
+// types named only in the field metadata get their registered mapping.
+func (o Options) ConvertField(field arrow.Field, arr arrow.Array, vec Vector, offset, count int) error {
+	storage := arr
+	if ea, ok := arr.(array.ExtensionArray); ok {
+		storage = ea.Storage()
+	}
+	ext, _, ok := ExtensionOf(field.Type, field.Metadata)
+	if !ok {
+		return o.Convert(storage, vec, offset, count)
+	}
+	switch ext.Target {
+	case TargetUUID:
+		copyValidity(storage, vec, offset, count)
+		uuidsToHugeints(unsafe.Slice((*Hugeint)(vec.Data()), count), fixedWidthValues(storage, 16, offset, count))
+	case TargetBoolean:
+		copyValidity(storage, vec, offset, count)
+		bytesToBools(unsafe.Slice((*uint8)(vec.Data()), count), fixedWidthValues(storage, 1, offset, count))
+	default:
+		return o.Convert(storage, vec, offset, count)
+	}
+	return nil
+}
+
+// fixedWidthValues returns the value bytes of count rows starting at offset.
+func fixedWidthValues(arr arrow.Array, width, offset, count int) []byte {
+	start := (arr.Data().Offset() + offset) * width
+	return arr.Data().Buffers()[1].Bytes()[start : start+count*width]
+}
+
+// uuidsToHugeints stores big-endian UUID bytes the way DuckDB stores UUIDs: as
+// a HUGEINT with the top bit flipped, so they sort like their text.
+func uuidsToHugeints(dst []Hugeint, src []byte) {
+	src = src[:len(dst)*16]
+	for i := range dst {
+		b := src[i*16 : i*16+16]
+		dst[i] = Hugeint{
+			Lower: binary.BigEndian.Uint64(b[8:]),
+			Upper: int64(binary.BigEndian.Uint64(b[:8]) ^ 1<<63),
+		}
+	}
+}
+
+// bytesToBools stores 1 for nonzero bytes and 0 otherwise.
+func bytesToBools(dst, src []uint8) {
+	src = src[:len(dst)]
+	for i, b := range src {
+		if b != 0 {
+			dst[i] = 1
+		} else {
+			dst[i] = 0
+		}
+	}
+}
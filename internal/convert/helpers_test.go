@@ -0,0 +1,30 @@
+package convert
+
+import (
+	"unsafe"
+
+	"github.com/apache/arrow-go/v18/arrow"
+)
+
+// arrayBytes returns the total size of the buffers backing arr.
+func arrayBytes(arr arrow.Array) int64 {
+	return dataBytes(arr.Data())
+}
+
+func dataBytes(data arrow.ArrayData) int64 {
+	var total int64
+	for _, buf := range data.Buffers() {
+		if buf != nil {
+			total += int64(buf.Len())
+		}
+	}
+	for _, child := range data.Children() {
+		total += dataBytes(child)
+	}
+	return total
+}
+
+// memSlice views the data buffer of a MemVector as a slice of T.
+func memSlice[T any](v *MemVector, n int) []T {
+	return unsafe.Slice((*T)(v.Data()), n)
+}
@@ -0,0 +1,307 @@
+package convert
+
+import (
+	"encoding/binary"
+	"math/bits"
+	"unsafe"
+
+	"github.com/apache/arrow-go/v18/arrow"
+)
+
+// MemVector is a Vector backed by Go memory, laid out the way DuckDB lays out a
+// vector of the logical type the extension maps the Arrow type to. It stands in
+// for real DuckDB vectors in unit tests and benchmarks, and the union and
+// run-end conversions use it in production to stage values before copying
+// them into the output vector.
+type MemVector struct {
+	// Validity is DuckDB's validity mask: bit set means valid. Nil means all rows valid.
+	Validity []uint64
+
+	typ      arrow.DataType
+	elemSize int
+	capacity int
+	data     []uint64 // 8-byte aligned backing store for fixed-width values
+	heap     []byte   // String arena, mimicking DuckDB's vector string heap
+	long     []string // Values over 12 bytes, indexed from their headers
+	children []*MemVector
+	listSize uint64
+}
+
+// NewMemVector creates a vector for the DuckDB type that Arrow type t maps to
+// with the default Options, able to hold capacity rows.
+func NewMemVector(t arrow.DataType, capacity int) *MemVector {
+	return Options{}.NewMemVector(t, capacity)
+}
+
+// NewMemVector creates a vector for the DuckDB type that Arrow type t maps to
+// under o, able to hold capacity rows.
+func (o Options) NewMemVector(t arrow.DataType, capacity int) *MemVector {
+	t = fieldLayout(arrow.Field{Type: t})
+	if ree, ok := t.(*arrow.RunEndEncodedType); ok && NativeRunEnd(ree) {
+		t = ree.Encoded()
+	}
+	v := &MemVector{typ: t, elemSize: o.physicalSize(t)}
+	v.grow(capacity)
+
+	switch dt := t.(type) {
+	case *arrow.StructType:
+		for _, field := range dt.Fields() {
+			v.children = append(v.children, o.NewMemVector(fieldLayout(field), capacity))
+		}
+	case *arrow.ListType:
+		v.children = []*MemVector{o.NewMemVector(dt.Elem(), 0)}
+	case *arrow.LargeListType:
+		v.children = []*MemVector{o.NewMemVector(dt.Elem(), 0)}
+	case *arrow.ListViewType:
+		v.children = []*MemVector{o.NewMemVector(dt.Elem(), 0)}
+	case *arrow.LargeListViewType:
+		v.children = []*MemVector{o.NewMemVector(dt.Elem(), 0)}
+	case *arrow.FixedSizeListType:
+		// DuckDB ARRAY children hold capacity * size elements, preallocated
+		v.children = []*MemVector{o.NewMemVector(dt.Elem(), capacity*int(dt.Len()))}
+	case *arrow.MapType:
+		// DuckDB MAP is a LIST of STRUCT{key, value}
+		entries := arrow.StructOf(
+			arrow.Field{Name: "key", Type: dt.KeyType()},
+			arrow.Field{Name: "value", Type: dt.ItemType(), Nullable: true},
+		)
+		v.children = []*MemVector{o.NewMemVector(entries, 0)}
+	case arrow.UnionType:
+		if !NativeUnion(dt) {
+			break
+		}
+		// DuckDB UNION is a STRUCT of the UTINYINT tag and the members
+		v.children = []*MemVector{o.NewMemVector(arrow.PrimitiveTypes.Uint8, capacity)}
+		for _, field := range dt.Fields() {
+			v.children = append(v.children, o.NewMemVector(field.Type, capacity))
+		}
+	}
+	return v
+}
+
+// grow resizes the vector (not its list child) to hold capacity rows, keeping contents.
+func (v *MemVector) grow(capacity int) {
+	if capacity <= v.capacity {
+		return
+	}
+	words := (capacity*v.elemSize + 7) / 8
+	data := make([]uint64, words)
+	copy(data, v.data)
+	v.data = data
+
+	if v.Validity != nil {
+		validity := make([]uint64, (capacity+63)/64)
+		for i := range validity {
+			validity[i] = ^uint64(0)
+		}
+		copy(validity, v.Validity)
+		v.Validity = validity
+	}
+	v.capacity = capacity
+
+	// List children are sized independently through ListReserve
+	switch dt := v.typ.(type) {
+	case *arrow.ListType, *arrow.LargeListType, *arrow.ListViewType, *arrow.LargeListViewType, *arrow.MapType:
+		return
+	case *arrow.FixedSizeListType:
+		if len(v.children) > 0 {
+			v.children[0].grow(capacity * int(dt.Len()))
+		}
+		return
+	}
+	for _, child := range v.children {
+		child.grow(capacity)
+	}
+}
+
+// Reset prepares the vector for the next chunk, like DuckDB's DataChunk::Reset.
+func (v *MemVector) Reset() {
+	v.Validity = nil
+	v.heap = v.heap[:0]
+	v.long = v.long[:0]
+	v.listSize = 0
+	for _, child := range v.children {
+		child.Reset()
+	}
+}
+
+// IsNull reports whether row was marked NULL.
+func (v *MemVector) IsNull(row int) bool {
+	return v.Validity != nil && v.Validity[row/64]&(1<<(row%64)) == 0
+}
+
+// ListSize returns the number of elements stored in the list child vector.
+func (v *MemVector) ListSize() uint64 {
+	return v.listSize
+}
+
+func (v *MemVector) Data() unsafe.Pointer {
+	if len(v.data) == 0 {
+		return nil
+	}
+	return unsafe.Pointer(&v.data[0])
+}
+
+func (v *MemVector) ValidityMask(count int) []uint64 {
+	if v.Validity == nil {
+		v.Validity = make([]uint64, (v.capacity+63)/64)
+		for i := range v.Validity {
+			v.Validity[i] = ^uint64(0)
+		}
+	}
+	return v.Validity[:(count+63)/64]
+}
+
+// String returns the VARCHAR or BLOB value stored in row.
+func (v *MemVector) String(row int) string {
+	header := v.stringHeader(row)
+	n := binary.LittleEndian.Uint32(header[:])
+	if n <= 12 {
+		return string(header[4 : 4+n])
+	}
+	return v.long[binary.LittleEndian.Uint64(header[8:])-1]
+}
+
+// stringHeader returns row's duckdb_string_t: the length, then the value if it
+// fits in 12 bytes, otherwise a 4-byte prefix. In place of a pointer, long
+// values store their 1-based index in long, which the GC can see. Copying a
+// header to another row shares the value, as it does in DuckDB.
+func (v *MemVector) stringHeader(row int) *[16]byte {
+	return (*[16]byte)(unsafe.Add(v.Data(), row*16))
+}
+
+func (v *MemVector) AssignString(row int, s string) {
+	header := v.stringHeader(row)
+	*header = [16]byte{}
+	binary.LittleEndian.PutUint32(header[:], uint32(len(s)))
+	if len(s) <= 12 {
+		copy(header[4:], s)
+		return
+	}
+	copy(header[4:8], s)
+	start := len(v.heap)
+	v.heap = append(v.heap, s...)
+	v.long = append(v.long, unsafe.String(unsafe.SliceData(v.heap[start:]), len(s)))
+	binary.LittleEndian.PutUint64(header[8:], uint64(len(v.long)))
+}
+
+func (v *MemVector) AssignStringsAt(rows []int32, data []byte, offsets []int32) {
+	for i, row := range rows {
+		v.AssignString(int(row), unsafe.String(&data[offsets[i]], offsets[i+1]-offsets[i]))
+	}
+}
+
+func (v *MemVector) AssignStrings32(data []byte, offsets []int32) {
+	for row := 0; row+1 < len(offsets); row++ {
+		if !v.IsNull(row) {
+			v.AssignString(row, unsafe.String(unsafe.SliceData(data[offsets[row]:]), offsets[row+1]-offsets[row]))
+		}
+	}
+}
+
+func (v *MemVector) AssignStrings64(data []byte, offsets []int64) {
+	for row := 0; row+1 < len(offsets); row++ {
+		if !v.IsNull(row) {
+			v.AssignString(row, unsafe.String(unsafe.SliceData(data[offsets[row]:]), offsets[row+1]-offsets[row]))
+		}
+	}
+}
+
+func (v *MemVector) StructChild(idx int) Vector {
+	return v.children[idx]
+}
+
+func (v *MemVector) ListChild() Vector {
+	return v.children[0]
+}
+
+// ListReserve grows the child to the next power of two, like DuckDB's
+// ListVector::Reserve, so growing lists reallocate a logarithmic number of times.
+func (v *MemVector) ListReserve(capacity uint64) {
+	if capacity > 0 {
+		v.children[0].grow(1 << bits.Len64(capacity-1))
+	}
+}
+
+func (v *MemVector) ListSetSize(size uint64) {
+	v.listSize = size
+}
+
+func (v *MemVector) ArrayChild() Vector {
+	return v.children[0]
+}
+
+// physicalSize returns the byte width of one value in the DuckDB vector for
+// Arrow type t, or 0 for types without a fixed-width data buffer.
+func (o Options) physicalSize(t arrow.DataType) int {
+	t = fieldLayout(arrow.Field{Type: t})
+	if dt, ok := decimalType(t); ok {
+		if width, _, ok := o.Decimal(dt); ok {
+			return decimalSize(width)
+		}
+		if o.WideDecimals == DecimalDouble {
+			return 8
+		}
+		return 16
+	}
+	if ut, ok := t.(arrow.UnionType); ok && NativeUnion(ut) {
+		return 0
+	}
+	switch t.ID() {
+	case arrow.BOOL, arrow.INT8, arrow.UINT8:
+		return 1
+	case arrow.INT16, arrow.UINT16:
+		return 2
+	case arrow.INT32, arrow.UINT32, arrow.FLOAT32, arrow.DATE32, arrow.DATE64:
+		return 4
+	case arrow.INT64, arrow.UINT64, arrow.FLOAT64, arrow.TIMESTAMP, arrow.TIME32, arrow.TIME64:
+		return 8
+	case arrow.DURATION, arrow.INTERVAL_MONTHS, arrow.INTERVAL_DAY_TIME, arrow.INTERVAL_MONTH_DAY_NANO:
+		return int(unsafe.Sizeof(Interval{}))
+	case arrow.LIST, arrow.LARGE_LIST, arrow.LIST_VIEW, arrow.LARGE_LIST_VIEW, arrow.MAP:
+		return int(unsafe.Sizeof(ListEntry{}))
+	case arrow.STRUCT, arrow.FIXED_SIZE_LIST:
+		return 0
+	default:
+		// VARCHAR and BLOB are duckdb_string_t
+		return 16
+	}
+}
+
+// storesStrings reports whether Arrow type t maps to VARCHAR or BLOB, either
+// directly or through the string fallback for unmapped types.
+func (o Options) storesStrings(t arrow.DataType) bool {
+	t = fieldLayout(arrow.Field{Type: t})
+	if dt, ok := decimalType(t); ok {
+		_, _, native := o.Decimal(dt)
+		return !native && o.WideDecimals == DecimalVarchar
+	}
+	if ut, ok := t.(arrow.UnionType); ok {
+		return !NativeUnion(ut)
+	}
+	switch t.ID() {
+	case arrow.BOOL, arrow.INT8, arrow.INT16, arrow.INT32, arrow.INT64,
+		arrow.UINT8, arrow.UINT16, arrow.UINT32, arrow.UINT64, arrow.FLOAT32, arrow.FLOAT64,
+		arrow.DATE32, arrow.DATE64, arrow.TIMESTAMP, arrow.TIME32, arrow.TIME64,
+		arrow.DURATION, arrow.INTERVAL_MONTHS, arrow.INTERVAL_DAY_TIME, arrow.INTERVAL_MONTH_DAY_NANO,
+		arrow.STRUCT, arrow.LIST, arrow.LARGE_LIST, arrow.LIST_VIEW, arrow.LARGE_LIST_VIEW,
+		arrow.FIXED_SIZE_LIST, arrow.MAP:
+		return false
+	}
+	return true
+}
+
+// decimalSize returns DuckDB's storage width for a DECIMAL of the given precision.
+// 1-4: INT16, 5-9: INT32, 10-18: INT64, 19-38: HUGEINT
+func decimalSize(precision int32) int {
+	switch {
+	case precision <= 4:
+		return 2
+	case precision <= 9:
+		return 4
+	case precision <= 18:
+		return 8
+	default:
+		return 16
+	}
+}
@@ -0,0 +1,158 @@
+package convert
+
+import (
+	"encoding/binary"
+	"fmt"
+	"sort"
+	"unsafe"
+
+	"github.com/apache/arrow-go/v18/arrow"
+	"github.com/apache/arrow-go/v18/arrow/array"
+)
+
+// NativeRunEnd reports whether run-end encoded columns of type t are decoded
+// into the DuckDB type of their values. Runs of nested values are not; the
+// extension maps them to VARCHAR instead.
+func NativeRunEnd(t *arrow.RunEndEncodedType) bool {
+	return !isNested(t.Encoded())
+}
+
+// rowRange is a half-open range of output rows.
+type rowRange struct {
+	from, to int
+}
+
+// convertRunEnd converts a run-end encoded column. Only the runs overlapping
+// the chunk are converted, once each, into a staging vector; each run's value
+// is then repeated across its rows. Long strings are stored once per run and
+// the run's other rows share that copy, so a constant column costs one value
+// conversion per chunk.
+func (o Options) convertRunEnd(col *array.RunEndEncoded, vec Vector, offset, count int) error {
+	if count == 0 {
+		return nil
+	}
+	numRuns, runEnd := runEndsOf(col.RunEndsArr())
+	start := col.Data().Offset() + offset
+	end := start + count
+	first := sort.Search(numRuns, func(i int) bool { return runEnd(i) > int64(start) })
+	last := sort.Search(numRuns, func(i int) bool { return runEnd(i) >= int64(end) })
+
+	runs := make([]rowRange, last-first+1)
+	for j := range runs {
+		runStart := int64(0)
+		if first+j > 0 {
+			runStart = runEnd(first + j - 1)
+		}
+		runs[j] = rowRange{
+			from: int(max(runStart, int64(start))) - start,
+			to:   int(min(runEnd(first+j), int64(end))) - start,
+		}
+	}
+
+	values := col.Values()
+	stage := o.NewMemVector(values.DataType(), len(runs))
+	if err := o.Convert(values, stage, first, len(runs)); err != nil {
+		return fmt.Errorf("run values: %w", err)
+	}
+
+	for j, r := range runs {
+		if stage.IsNull(j) {
+			clearBits(vec.ValidityMask(count), r.from, r.to)
+		}
+	}
+	if o.storesStrings(values.DataType()) {
+		fillStringRuns(vec, stage, runs, count)
+		return nil
+	}
+	switch stage.elemSize {
+	case 1:
+		fillRuns[uint8](vec, stage, runs, count)
+	case 2:
+		fillRuns[uint16](vec, stage, runs, count)
+	case 4:
+		fillRuns[uint32](vec, stage, runs, count)
+	case 8:
+		fillRuns[uint64](vec, stage, runs, count)
+	case 16:
+		fillRuns[[2]uint64](vec, stage, runs, count)
+	default:
+		return fmt.Errorf("run-end encoded %s values are not supported", values.DataType())
+	}
+	return nil
+}
+
+// runEndsOf returns the number of run ends in an Int16, Int32 or Int64 array
+// and a function reading the i'th one in place. Chunks binary-search the
+// run ends, so nothing is copied per chunk.
+func runEndsOf(arr arrow.Array) (int, func(i int) int64) {
+	switch a := arr.(type) {
+	case *array.Int16:
+		ends := a.Int16Values()
+		return len(ends), func(i int) int64 { return int64(ends[i]) }
+	case *array.Int32:
+		ends := a.Int32Values()
+		return len(ends), func(i int) int64 { return int64(ends[i]) }
+	case *array.Int64:
+		ends := a.Int64Values()
+		return len(ends), func(i int) int64 { return ends[i] }
+	}
+	return 0, nil
+}
+
+// fillRuns repeats each staged fixed-width value across its run's rows.
+func fillRuns[T any](vec Vector, stage *MemVector, runs []rowRange, count int) {
+	dst := unsafe.Slice((*T)(vec.Data()), count)
+	src := unsafe.Slice((*T)(stage.Data()), len(runs))
+	for j, r := range runs {
+		v := src[j]
+		for i := r.from; i < r.to; i++ {
+			dst[i] = v
+		}
+	}
+}
+
+// fillStringRuns repeats each staged string across its run's rows. Inline
+// strings are plain header copies. A long string is stored in the run's first
+// row, and the other rows copy that row's header, pointing at the same heap copy.
+func fillStringRuns(vec Vector, stage *MemVector, runs []rowRange, count int) {
+	headers := unsafe.Slice((*[viewSize]byte)(vec.Data()), count)
+	isLong := func(j int) bool {
+		return !stage.IsNull(j) && binary.LittleEndian.Uint32(stage.stringHeader(j)[:]) > 12
+	}
+
+	var rows []int32
+	var long []byte
+	offsets := []int32{0}
+	for j, r := range runs {
+		switch {
+		case stage.IsNull(j) || r.from == r.to:
+		case isLong(j):
+			long = append(long, stage.String(j)...)
+			rows = append(rows, int32(r.from))
+			offsets = append(offsets, int32(len(long)))
+		default:
+			header := *stage.stringHeader(j)
+			for i := r.from; i < r.to; i++ {
+				headers[i] = header
+			}
+		}
+	}
+	if len(rows) == 0 {
+		return
+	}
+	vec.AssignStringsAt(rows, long, offsets)
+	for j, r := range runs {
+		if r.to-r.from > 1 && isLong(j) {
+			for i := r.from + 1; i < r.to; i++ {
+				headers[i] = headers[r.from]
+			}
+		}
+	}
+}
+
+// clearBits marks rows [from, to) invalid in a validity mask.
+func clearBits(mask []uint64, from, to int) {
+	for i := from; i < to; i++ {
+		mask[i/64] &^= 1 << (i % 64)
+	}
+}
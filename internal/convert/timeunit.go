@@ -0,0 +1,92 @@
+package convert
+
+// Unit conversion kernels for temporal types. Each kernel handles one unit
+// with a constant factor, so the unit switch stays outside the loop and the
+// compiler turns division into a multiply-shift. The loops are branch-free and
+// run over NULL slots too (DuckDB ignores values under invalid rows).
+//
+// Scale-down uses floor division: Arrow values before the epoch are negative,
+// and truncating toward zero would move them forward in time (-1ns is
+// 1969-12-31 23:59:59.999999, not the epoch).
+
+import "github.com/apache/arrow-go/v18/arrow"
+
+const (
+	nanosPerMicro = 1_000
+	millisPerDay  = 24 * 60 * 60 * 1_000
+)
+
+// scaleUp sets dst[i] = src[i] * factor, for units coarser than DuckDB's.
+func scaleUp[S ~int32 | ~int64](dst []int64, src []S, factor int64) {
+	src = src[:len(dst)]
+	for i, v := range src {
+		dst[i] = int64(v) * factor
+	}
+}
+
+// floorMicros returns floor(nanos / 1000).
+func floorMicros(nanos int64) int64 {
+	q := nanos / nanosPerMicro
+	r := nanos - q*nanosPerMicro
+	// r>>63 is -1 when the remainder is negative, rounding down instead of toward zero
+	return q + r>>63
+}
+
+// nanosToMicros sets dst[i] = floor(src[i] / 1000).
+func nanosToMicros[S ~int64](dst []int64, src []S) {
+	src = src[:len(dst)]
+	for i, v := range src {
+		dst[i] = floorMicros(int64(v))
+	}
+}
+
+// scaleToIntervals sets dst[i] to an interval of src[i] * factor microseconds.
+func scaleToIntervals[S ~int64](dst []Interval, src []S, factor int64) {
+	src = src[:len(dst)]
+	for i, v := range src {
+		dst[i] = Interval{Micros: int64(v) * factor}
+	}
+}
+
+// nanosToIntervals sets dst[i] to an interval of floor(src[i] / 1000) microseconds.
+func nanosToIntervals[S ~int64](dst []Interval, src []S) {
+	src = src[:len(dst)]
+	for i, v := range src {
+		dst[i] = Interval{Micros: floorMicros(int64(v))}
+	}
+}
+
+// monthDayNanosToIntervals converts Arrow month-day-nano intervals, which only
+// differ from DuckDB's in the sub-day unit.
+func monthDayNanosToIntervals(dst []Interval, src []arrow.MonthDayNanoInterval) {
+	src = src[:len(dst)]
+	for i, v := range src {
+		dst[i] = Interval{Months: v.Months, Days: v.Days, Micros: floorMicros(v.Nanoseconds)}
+	}
+}
+
+// dayTimesToIntervals converts Arrow day-time (days, milliseconds) intervals.
+func dayTimesToIntervals(dst []Interval, src []arrow.DayTimeInterval) {
+	src = src[:len(dst)]
+	for i, v := range src {
+		dst[i] = Interval{Days: v.Days, Micros: int64(v.Milliseconds) * 1_000}
+	}
+}
+
+// monthsToIntervals converts Arrow month intervals.
+func monthsToIntervals(dst []Interval, src []arrow.MonthInterval) {
+	src = src[:len(dst)]
+	for i, v := range src {
+		dst[i] = Interval{Months: int32(v)}
+	}
+}
+
+// millisToDays sets dst[i] = floor(src[i] / 86400000), for Date64.
+func millisToDays[S ~int64](dst []int32, src []S) {
+	src = src[:len(dst)]
+	for i, v := range src {
+		q := int64(v) / millisPerDay
+		r := int64(v) - q*millisPerDay
+		dst[i] = int32(q + r>>63)
+	}
+}
@@ -0,0 +1,201 @@
+package convert
+
+import (
+	"encoding/binary"
+	"fmt"
+	"unsafe"
+
+	"github.com/apache/arrow-go/v18/arrow"
+	"github.com/apache/arrow-go/v18/arrow/array"
+)
+
+// isNested reports whether values of Arrow type t are spread over child
+// vectors rather than stored in one fixed-width slot.
+func isNested(t arrow.DataType) bool {
+	switch fieldLayout(arrow.Field{Type: t}).ID() {
+	case arrow.STRUCT, arrow.LIST, arrow.LARGE_LIST, arrow.LIST_VIEW, arrow.LARGE_LIST_VIEW,
+		arrow.FIXED_SIZE_LIST, arrow.MAP, arrow.RUN_END_ENCODED, arrow.SPARSE_UNION, arrow.DENSE_UNION:
+		return true
+	}
+	return false
+}
+
+// NativeUnion reports whether union columns of type t are converted to a
+// DuckDB UNION. Dense union members are gathered value by value, so dense
+// unions with nested members are not; the extension maps them to VARCHAR.
+func NativeUnion(t arrow.UnionType) bool {
+	if len(t.Fields()) == 0 {
+		return false
+	}
+	if t.Mode() == arrow.SparseMode {
+		return true
+	}
+	for _, field := range t.Fields() {
+		if isNested(field.Type) {
+			return false
+		}
+	}
+	return true
+}
+
+// A DuckDB UNION vector is a STRUCT whose child 0 is the UTINYINT tag (the
+// selected member's index) and children 1..n are the members. Rows hold NULL
+// in every member but the selected one.
+
+// convertSparseUnion converts a sparse union. Every member array has a value
+// for every row, so each member is converted in bulk straight into its
+// vector, then masked down to the rows that select it.
+func (o Options) convertSparseUnion(col *array.SparseUnion, vec Vector, offset, count int) error {
+	tags := unionTags(col, vec, offset, count)
+	for j := 0; j < col.NumFields(); j++ {
+		// Sparse members are sliced with the union, so rows line up
+		if err := o.Convert(col.Field(j), vec.StructChild(j+1), offset, count); err != nil {
+			return fmt.Errorf("union member %d: %w", j, err)
+		}
+	}
+	selectMembers(vec, tags, col.NumFields(), count)
+	return nil
+}
+
+// convertDenseUnion converts a dense union. For each member, the child range
+// the chunk's rows point into is converted once into a staging vector, and
+// values are then gathered into the rows that select the member.
+func (o Options) convertDenseUnion(col *array.DenseUnion, vec Vector, offset, count int) error {
+	tags := unionTags(col, vec, offset, count)
+	valueOffsets := col.RawValueOffsets()[offset : offset+count]
+
+	rows := make([][]int32, col.NumFields())
+	for i, tag := range tags {
+		rows[tag] = append(rows[tag], int32(i))
+	}
+	for j, memberRows := range rows {
+		if len(memberRows) == 0 {
+			continue
+		}
+		lo, hi := valueOffsets[memberRows[0]], valueOffsets[memberRows[0]]
+		src := make([]int32, len(memberRows))
+		for k, row := range memberRows {
+			src[k] = valueOffsets[row]
+			lo, hi = min(lo, src[k]), max(hi, src[k])
+		}
+		for k := range src {
+			src[k] -= lo
+		}
+
+		child := col.Field(j)
+		stage := o.NewMemVector(child.DataType(), int(hi-lo)+1)
+		if err := o.Convert(child, stage, int(lo), int(hi-lo)+1); err != nil {
+			return fmt.Errorf("union member %d: %w", j, err)
+		}
+		if err := o.gather(vec.StructChild(j+1), stage, child.DataType(), memberRows, src, count); err != nil {
+			return fmt.Errorf("union member %d: %w", j, err)
+		}
+	}
+	selectMembers(vec, tags, col.NumFields(), count)
+	return nil
+}
+
+// unionTags writes each row's member index to the tag vector and returns it.
+func unionTags(col array.Union, vec Vector, offset, count int) []uint8 {
+	childIDs := col.DataType().(arrow.UnionType).ChildIDs()
+	tags := unsafe.Slice((*uint8)(vec.StructChild(0).Data()), count)
+	for i, code := range col.RawTypeCodes()[offset : offset+count] {
+		tags[i] = uint8(childIDs[code])
+	}
+	return tags
+}
+
+// selectMembers marks each member NULL in the rows that select another
+// member, and marks the union itself NULL where the selected member is NULL,
+// which is how Arrow defines union NULLs.
+func selectMembers(vec Vector, tags []uint8, members, count int) {
+	if count == 0 {
+		return
+	}
+	words := (count + 63) / 64
+	selected := make([]uint64, members*words)
+	for i, tag := range tags {
+		selected[int(tag)*words+i/64] |= 1 << (i % 64)
+	}
+	valid := make([]uint64, words)
+	for j := 0; j < members; j++ {
+		mask := vec.StructChild(j + 1).ValidityMask(count)
+		for w := range mask {
+			mask[w] &= selected[j*words+w]
+			valid[w] |= mask[w]
+		}
+	}
+	for w, bits := range valid {
+		full := ^uint64(0)
+		if w == words-1 && count%64 != 0 {
+			full = 1<<(count%64) - 1
+		}
+		if bits&full != full {
+			vec.ValidityMask(count)[w] &= bits
+		}
+	}
+}
+
+// gather copies staged value src[k] to row rows[k] of vec, for fixed-width
+// and string values.
+func (o Options) gather(vec Vector, stage *MemVector, t arrow.DataType, rows, src []int32, count int) error {
+	if stage.Validity != nil {
+		for k, row := range rows {
+			if stage.IsNull(int(src[k])) {
+				clearBits(vec.ValidityMask(count), int(row), int(row)+1)
+			}
+		}
+	}
+	if o.storesStrings(t) {
+		gatherStrings(vec, stage, rows, src, count)
+		return nil
+	}
+	switch stage.elemSize {
+	case 1:
+		gatherValues[uint8](vec, stage, rows, src, count)
+	case 2:
+		gatherValues[uint16](vec, stage, rows, src, count)
+	case 4:
+		gatherValues[uint32](vec, stage, rows, src, count)
+	case 8:
+		gatherValues[uint64](vec, stage, rows, src, count)
+	case 16:
+		gatherValues[[2]uint64](vec, stage, rows, src, count)
+	default:
+		return fmt.Errorf("%s values cannot be gathered", t)
+	}
+	return nil
+}
+
+// gatherValues copies fixed-width staged values to their rows.
+func gatherValues[T any](vec Vector, stage *MemVector, rows, src []int32, count int) {
+	dst := unsafe.Slice((*T)(vec.Data()), count)
+	vals := unsafe.Slice((*T)(stage.Data()), stage.capacity)
+	for k, row := range rows {
+		dst[row] = vals[src[k]]
+	}
+}
+
+// gatherStrings copies staged strings to their rows. Inline strings are plain
+// header copies; long strings are stored with one AssignStringsAt call.
+func gatherStrings(vec Vector, stage *MemVector, rows, src []int32, count int) {
+	headers := unsafe.Slice((*[viewSize]byte)(vec.Data()), count)
+	var longRows []int32
+	var long []byte
+	offsets := []int32{0}
+	for k, row := range rows {
+		j := int(src[k])
+		switch {
+		case stage.IsNull(j):
+		case binary.LittleEndian.Uint32(stage.stringHeader(j)[:]) > 12:
+			long = append(long, stage.String(j)...)
+			longRows = append(longRows, row)
+			offsets = append(offsets, int32(len(long)))
+		default:
+			headers[row] = *stage.stringHeader(j)
+		}
+	}
+	if len(longRows) > 0 {
+		vec.AssignStringsAt(longRows, long, offsets)
+	}
+}
@@ -0,0 +1,61 @@
+// Package convert implements the Arrow to DuckDB vector conversion kernels used
+// by the duckarrow scan. Kernels write into DuckDB's physical vector layout
+// through the Vector interface, so they can be unit tested and benchmarked
+// without CGO or a DuckDB runtime.
+package convert
+
+import "unsafe"
+
+// Vector is the subset of the DuckDB vector API needed by the conversion kernels.
+// The extension implements it on top of duckdb_vector; tests and benchmarks use
+// MemVector, which has the same memory layout backed by Go memory and also
+// stages union and run-end values during conversion.
+type Vector interface {
+	// Data returns the vector's data buffer (duckdb_vector_get_data).
+	Data() unsafe.Pointer
+	// ValidityMask returns the writable validity mask covering rows [0, count),
+	// allocating it if needed (duckdb_vector_ensure_validity_writable).
+	ValidityMask(count int) []uint64
+	// AssignString stores a VARCHAR value (duckdb_vector_assign_string_element_len).
+	AssignString(row int, s string)
+	// AssignStrings32 stores VARCHAR or BLOB values in rows [0, len(offsets)-1),
+	// row i being data[offsets[i]:offsets[i+1]]. Rows already NULL in the
+	// validity mask are skipped. This is one call per column, not per row.
+	AssignStrings32(data []byte, offsets []int32)
+	// AssignStrings64 is AssignStrings32 for 64-bit offsets.
+	AssignStrings64(data []byte, offsets []int64)
+	// AssignStringsAt stores data[offsets[i]:offsets[i+1]] in row rows[i], for
+	// a sparse set of rows in one call.
+	AssignStringsAt(rows []int32, data []byte, offsets []int32)
+	// StructChild returns the child vector of a STRUCT field, or of a UNION,
+	// whose child 0 is the tag and children 1..n are the members.
+	StructChild(idx int) Vector
+	// ListChild returns the child vector of a LIST or MAP.
+	ListChild() Vector
+	// ListReserve ensures the list child vector can hold capacity elements.
+	ListReserve(capacity uint64)
+	// ListSetSize sets the number of elements in the list child vector.
+	ListSetSize(size uint64)
+	// ArrayChild returns the child vector of a fixed-size ARRAY, which holds
+	// size elements per row contiguously and is preallocated by DuckDB.
+	ArrayChild() Vector
+}
+
+// Hugeint matches duckdb_hugeint: a 128-bit two's complement integer.
+type Hugeint struct {
+	Lower uint64
+	Upper int64
+}
+
+// Interval matches duckdb_interval.
+type Interval struct {
+	Months int32
+	Days   int32
+	Micros int64
+}
+
+// ListEntry matches duckdb_list_entry.
+type ListEntry struct {
+	Offset uint64
+	Length uint64
+}
@@ -0,0 +1,99 @@
+package convert
+
+import (
+	"encoding/binary"
+	"fmt"
+	"unsafe"
+
+	"github.com/apache/arrow-go/v18/arrow"
+	"github.com/apache/arrow-go/v18/arrow/array"
+)
+
+// viewSize is the width of an Arrow view header and of duckdb_string_t.
+const viewSize = 16
+
+// convertViews converts Utf8View and BinaryView columns. Arrow view headers
+// and duckdb_string_t share a layout for values of up to 12 bytes (a 4-byte
+// length followed by the inline bytes), so all headers are copied in one
+// block and only longer values, whose headers point into Arrow's data
+// buffers, are stored through the vector.
+func convertViews(arr arrow.Array, vec Vector, offset, count int) {
+	if count == 0 {
+		return
+	}
+	data := arr.Data()
+	start := (data.Offset() + offset) * viewSize
+	dst := unsafe.Slice((*byte)(vec.Data()), count*viewSize)
+	copy(dst, data.Buffers()[1].Bytes()[start:start+count*viewSize])
+
+	buffers := data.Buffers()[2:]
+	var rows []int32
+	var long []byte
+	offsets := []int32{0}
+	for i := 0; i < count; i++ {
+		header := dst[i*viewSize : (i+1)*viewSize]
+		n := int(binary.LittleEndian.Uint32(header))
+		if n <= 12 {
+			// DuckDB compares inline strings a word at a time, so padding must be zero
+			clear(header[4+n:])
+			continue
+		}
+		if arr.IsNull(offset + i) {
+			// The header of a NULL row may hold any length and buffer reference
+			clear(header)
+			continue
+		}
+		bufIdx := binary.LittleEndian.Uint32(header[8:])
+		bufOffset := int(binary.LittleEndian.Uint32(header[12:]))
+		long = append(long, buffers[bufIdx].Bytes()[bufOffset:bufOffset+n]...)
+		rows = append(rows, int32(i))
+		offsets = append(offsets, int32(len(long)))
+	}
+	if len(rows) > 0 {
+		vec.AssignStringsAt(rows, long, offsets)
+	}
+}
+
+// convertListView converts ListView and LargeListView columns to LIST. DuckDB
+// list entries are already (offset, length) views into the child vector, so
+// rows may overlap or be out of order; only the child range the chunk's rows
+// span is converted.
+func (o Options) convertListView(col array.ListLike, vec Vector, offset, count int) error {
+	entries := unsafe.Slice((*ListEntry)(vec.Data()), count)
+
+	// First pass: find the child range and record absolute offsets
+	lo, hi := int64(-1), int64(0)
+	for i := 0; i < count; i++ {
+		if col.IsNull(offset + i) {
+			entries[i] = ListEntry{}
+			continue
+		}
+		start, end := col.ValueOffsets(offset + i)
+		if end == start {
+			entries[i] = ListEntry{}
+			continue
+		}
+		if lo < 0 || start < lo {
+			lo = start
+		}
+		hi = max(hi, end)
+		entries[i] = ListEntry{Offset: uint64(start), Length: uint64(end - start)}
+	}
+	if lo < 0 {
+		vec.ListSetSize(0)
+		return nil
+	}
+
+	// Second pass: make offsets relative to the converted range
+	for i := range entries {
+		if entries[i].Length > 0 {
+			entries[i].Offset -= uint64(lo)
+		}
+	}
+	vec.ListReserve(uint64(hi - lo))
+	if err := o.Convert(col.ListValues(), vec.ListChild(), int(lo), int(hi-lo)); err != nil {
+		return fmt.Errorf("list view elements: %w", err)
+	}
+	vec.ListSetSize(uint64(hi - lo))
+	return nil
+}
@@ -0,0 +1,97 @@
+package flight
+
+import (
+	"fmt"
+	"sort"
+	"strconv"
+	"strings"
+	"sync"
+)
+
+// Flight SQL has no standard way to ask for a batch size, so preferred sizes
+// are sent as gRPC headers on every statement. Servers that understand them
+// size their record batches accordingly; others ignore them.
+const (
+	HeaderBatchRows  = "x-duckarrow-batch-rows"
+	HeaderBatchBytes = "x-duckarrow-batch-bytes"
+)
+
+// VectorSize is DuckDB's STANDARD_VECTOR_SIZE, the rows in a full chunk.
+const VectorSize = 2048
+
+// BatchRows and BatchBytes are the preferred result batch sizes per server.
+var (
+	BatchRows  = &PerServer{}
+	BatchBytes = &PerServer{}
+)
+
+// AlignRows rounds a preferred batch row count up to a multiple of
+// VectorSize, so every batch splits into full DuckDB chunks.
+func AlignRows(rows int64) int64 {
+	return (rows + VectorSize - 1) / VectorSize * VectorSize
+}
+
+// PerServer is a non-negative number with optional overrides per server URI.
+// Zero means no preference. It is safe for concurrent use.
+type PerServer struct {
+	mu    sync.RWMutex
+	def   int64
+	byURI map[string]int64
+}
+
+// For returns the value for the server at uri.
+func (p *PerServer) For(uri string) int64 {
+	p.mu.RLock()
+	defer p.mu.RUnlock()
+	if n, ok := p.byURI[uri]; ok {
+		return n
+	}
+	return p.def
+}
+
+// Set replaces the values from a comma-separated list of entries, each
+// either N (the default for every server) or URI=N. N follows the last "=",
+// so URIs may contain "=" in their query string. An empty string clears
+// every value.
+func (p *PerServer) Set(value string) error {
+	var def int64
+	byURI := make(map[string]int64)
+	for _, entry := range strings.Split(value, ",") {
+		entry = strings.TrimSpace(entry)
+		if entry == "" {
+			continue
+		}
+		uri, num := "", entry
+		i := strings.LastIndex(entry, "=")
+		hasURI := i >= 0
+		if hasURI {
+			uri, num = entry[:i], entry[i+1:]
+		}
+		n, err := strconv.ParseInt(strings.TrimSpace(num), 10, 64)
+		if err != nil || n < 0 {
+			return fmt.Errorf("invalid entry %q (expected N or URI=N with N >= 0)", entry)
+		}
+		if hasURI {
+			byURI[strings.TrimSpace(uri)] = n
+		} else {
+			def = n
+		}
+	}
+
+	p.mu.Lock()
+	defer p.mu.Unlock()
+	p.def, p.byURI = def, byURI
+	return nil
+}
+
+// String formats the values the way Set reads them, overrides sorted by URI.
+func (p *PerServer) String() string {
+	p.mu.RLock()
+	defer p.mu.RUnlock()
+	entries := []string{strconv.FormatInt(p.def, 10)}
+	for uri, n := range p.byURI {
+		entries = append(entries, uri+"="+strconv.FormatInt(n, 10))
+	}
+	sort.Strings(entries[1:])
+	return strings.Join(entries, ", ")
+}
@@ -0,0 +1,47 @@
+package flight
+
+import "testing"
+
+func TestPerServer(t *testing.T) {
+	var p PerServer
+	if got := p.For("grpc://a:1"); got != 0 {
+		t.Errorf("unset value = %d, want 0", got)
+	}
+	if err := p.Set(" grpc://b:2=8192, 65536 ,grpc://a:1=0"); err != nil {
+		t.Fatal(err)
+	}
+	for uri, want := range map[string]int64{"grpc://a:1": 0, "grpc://b:2": 8192, "grpc://c:3": 65536} {
+		if got := p.For(uri); got != want {
+			t.Errorf("For(%s) = %d, want %d", uri, got, want)
+		}
+	}
+	if got, want := p.String(), "65536, grpc://a:1=0, grpc://b:2=8192"; got != want {
+		t.Errorf("String() = %q, want %q", got, want)
+	}
+
+	for _, bad := range []string{"-1", "grpc://a:1=x", "many"} {
+		if err := p.Set(bad); err == nil {
+			t.Errorf("Set(%q) should fail", bad)
+		}
+	}
+	if p.For("grpc://b:2") != 8192 {
+		t.Error("a failed Set should keep the previous values")
+	}
+	if err := p.Set("grpc://h:1?x=y=2048"); err != nil {
+		t.Fatal(err)
+	}
+	if got := p.For("grpc://h:1?x=y"); got != 2048 {
+		t.Errorf("For(grpc://h:1?x=y) = %d, want 2048", got)
+	}
+	if err := p.Set(""); err != nil || p.String() != "0" {
+		t.Errorf("Set(\"\") = %v, String() = %q; want cleared", err, p.String())
+	}
+}
+
+func TestAlignRows(t *testing.T) {
+	for rows, want := range map[int64]int64{1: 2048, 2048: 2048, 3000: 4096, 65536: 65536} {
+		if got := AlignRows(rows); got != want {
+			t.Errorf("AlignRows(%d) = %d, want %d", rows, got, want)
+		}
+	}
+}
@@ -0,0 +1,243 @@
+package flight
+
+import (
+	"context"
+	"fmt"
+	"sync"
+	"time"
+
+	"github.com/apache/arrow-adbc/go/adbc"
+	"github.com/apache/arrow-go/v18/arrow"
+	"github.com/apache/arrow-go/v18/arrow/array"
+)
+
+// TableInfo describes one remote table, as listed by GetObjects.
+type TableInfo struct {
+	Catalog string
+	Schema  string
+	Name    string
+	Type    string // e.g. "TABLE" or "VIEW"
+	Columns []ColumnInfo
+}
+
+// ColumnInfo describes one column of a remote table.
+type ColumnInfo struct {
+	Name     string
+	Position int32  // 1-based ordinal position
+	TypeName string // Server's type name, or "" if it gives none
+	Nullable *bool  // Nil if the server does not say
+}
+
+// Objects lists every remote table with its columns in one GetObjects call.
+func (c *Client) Objects(ctx context.Context) ([]TableInfo, error) {
+	reader, err := c.conn.GetObjects(ctx, adbc.ObjectDepthAll, nil, nil, nil, nil, nil)
+	if err != nil {
+		return nil, fmt.Errorf("get objects: %w", err)
+	}
+	defer reader.Release()
+
+	var tables []TableInfo
+	for reader.Next() {
+		tables = appendObjects(tables, reader.RecordBatch())
+	}
+	if err := reader.Err(); err != nil {
+		return nil, fmt.Errorf("read objects: %w", err)
+	}
+	return tables, nil
+}
+
+// appendObjects flattens one batch of ADBC's nested GetObjects result
+// (catalogs > db_schemas > tables > columns) into tables.
+func appendObjects(tables []TableInfo, rec arrow.RecordBatch) []TableInfo {
+	catalogs := rec.Column(0).(*array.String)
+	schemaLists := rec.Column(1).(*array.List)
+	schemas := schemaLists.ListValues().(*array.Struct)
+	schemaNames := structField(schemas, "db_schema_name").(*array.String)
+	tableLists := structField(schemas, "db_schema_tables").(*array.List)
+	tableStructs := tableLists.ListValues().(*array.Struct)
+	tableNames := structField(tableStructs, "table_name").(*array.String)
+	tableTypes := structField(tableStructs, "table_type").(*array.String)
+	columnLists := structField(tableStructs, "table_columns").(*array.List)
+	columns := columnLists.ListValues().(*array.Struct)
+	columnNames := structField(columns, "column_name").(*array.String)
+	positions := structField(columns, "ordinal_position").(*array.Int32)
+	typeNames := structField(columns, "xdbc_type_name").(*array.String)
+	nullables := structField(columns, "xdbc_nullable").(*array.Int16)
+
+	for i := 0; i < catalogs.Len(); i++ {
+		for _, j := range listRange(schemaLists, i) {
+			for _, k := range listRange(tableLists, j) {
+				t := TableInfo{
+					Catalog: catalogs.Value(i),
+					Schema:  schemaNames.Value(j),
+					Name:    tableNames.Value(k),
+					Type:    tableTypes.Value(k),
+				}
+				for _, c := range listRange(columnLists, k) {
+					col := ColumnInfo{Name: columnNames.Value(c), Position: positions.Value(c)}
+					if typeNames.IsValid(c) {
+						col.TypeName = typeNames.Value(c)
+					}
+					if nullables.IsValid(c) {
+						// xdbc_nullable is SQL's NO_NULLS (0), NULLABLE (1) or NULLABLE_UNKNOWN (2)
+						switch nullables.Value(c) {
+						case 0:
+							col.Nullable = new(bool)
+						case 1:
+							nullable := true
+							col.Nullable = &nullable
+						}
+					}
+					t.Columns = append(t.Columns, col)
+				}
+				tables = append(tables, t)
+			}
+		}
+	}
+	return tables
+}
+
+// structField returns the child of s named name.
+func structField(s *array.Struct, name string) arrow.Array {
+	idx, _ := s.DataType().(*arrow.StructType).FieldIdx(name)
+	return s.Field(idx)
+}
+
+// listRange returns the child indexes of row i of a list, none if it is NULL.
+func listRange(list *array.List, i int) []int {
+	if list.IsNull(i) {
+		return nil
+	}
+	start, end := list.ValueOffsets(i)
+	idx := make([]int, end-start)
+	for n := range idx {
+		idx[n] = int(start) + n
+	}
+	return idx
+}
+
+// CatalogCache keeps each server's table listing for a TTL. Once a listing
+// is stale it is still returned, and one background refresh replaces it, so
+// tools that list tables on every connection do not wait on the server.
+// It is safe for concurrent use.
+type CatalogCache struct {
+	mu      sync.Mutex
+	ttl     time.Duration
+	entries map[string]*catalogEntry
+	fetch   func(context.Context, Config) ([]TableInfo, error)
+}
+
+type catalogEntry struct {
+	ready      chan struct{} // Closed once the first fetch finished
+	tables     []TableInfo
+	err        error // Error of the first fetch
+	fetchedAt  time.Time
+	refreshing bool
+}
+
+// DefaultCatalogTTL is how long a table listing is served without a refresh.
+const DefaultCatalogTTL = 5 * time.Minute
+
+// Catalog is the catalog cache used by the extension.
+var Catalog = NewCatalogCache(DefaultCatalogTTL, fetchObjects)
+
+// NewCatalogCache creates a cache that lists tables with fetch.
+func NewCatalogCache(ttl time.Duration, fetch func(context.Context, Config) ([]TableInfo, error)) *CatalogCache {
+	return &CatalogCache{ttl: ttl, entries: make(map[string]*catalogEntry), fetch: fetch}
+}
+
+// fetchObjects lists a server's tables over a pooled connection.
+func fetchObjects(ctx context.Context, cfg Config) ([]TableInfo, error) {
+	conn, err := GetConnection(ctx, cfg)
+	if err != nil {
+		return nil, err
+	}
+	defer func() {
+		if conn.IsPooled {
+			ReleaseConnection(cfg)
+		} else {
+			conn.Client.Close()
+		}
+	}()
+	return conn.Client.Objects(ctx)
+}
+
+// TTL returns how long listings are served without a refresh.
+func (c *CatalogCache) TTL() time.Duration {
+	c.mu.Lock()
+	defer c.mu.Unlock()
+	return c.ttl
+}
+
+// SetTTL changes how long listings are served without a refresh. Zero
+// disables caching: every call lists the server's tables.
+func (c *CatalogCache) SetTTL(ttl time.Duration) {
+	c.mu.Lock()
+	defer c.mu.Unlock()
+	c.ttl = ttl
+}
+
+// Tables returns the server's tables. The first call for a server waits for
+// the listing, as do concurrent callers; later calls return the cached one.
+func (c *CatalogCache) Tables(ctx context.Context, cfg Config) ([]TableInfo, error) {
+	key := globalPool.configKey(cfg)
+	c.mu.Lock()
+	if c.ttl <= 0 {
+		c.mu.Unlock()
+		return c.fetch(ctx, cfg)
+	}
+	e, ok := c.entries[key]
+	if !ok {
+		e = &catalogEntry{ready: make(chan struct{})}
+		c.entries[key] = e
+		c.mu.Unlock()
+
+		tables, err := c.fetch(ctx, cfg)
+		c.mu.Lock()
+		e.tables, e.err, e.fetchedAt = tables, err, time.Now()
+		if err != nil && c.entries[key] == e {
+			// Failures are not cached; the next call retries
+			delete(c.entries, key)
+		}
+		c.mu.Unlock()
+		close(e.ready)
+		return tables, err
+	}
+	c.mu.Unlock()
+
+	select {
+	case <-e.ready:
+	case <-ctx.Done():
+		return nil, ctx.Err()
+	}
+
+	c.mu.Lock()
+	defer c.mu.Unlock()
+	if e.err != nil {
+		return nil, e.err
+	}
+	if time.Since(e.fetchedAt) >= c.ttl && !e.refreshing && c.entries[key] == e {
+		e.refreshing = true
+		go c.refresh(key, e, cfg)
+	}
+	return e.tables, nil
+}
+
+// refresh replaces e's listing in the background. On failure the stale
+// listing stays, and the next call tries again.
+func (c *CatalogCache) refresh(key string, e *catalogEntry, cfg Config) {
+	tables, err := c.fetch(context.Background(), cfg)
+	c.mu.Lock()
+	defer c.mu.Unlock()
+	e.refreshing = false
+	if err == nil {
+		e.tables, e.fetchedAt = tables, time.Now()
+	}
+}
+
+// Invalidate drops every cached listing, so the next call lists tables again.
+func (c *CatalogCache) Invalidate() {
+	c.mu.Lock()
+	defer c.mu.Unlock()
+	c.entries = make(map[string]*catalogEntry)
+}
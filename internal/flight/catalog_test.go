@@ -0,0 +1,136 @@
+package flight
+
+import (
+	"context"
+	"errors"
+	"sync"
+	"sync/atomic"
+	"testing"
+	"time"
+)
+
+// countingFetch returns a fetch function that lists one table named after
+// the number of calls so far, and the call counter.
+func countingFetch(fail *atomic.Bool) (func(context.Context, Config) ([]TableInfo, error), *atomic.Int32) {
+	var calls atomic.Int32
+	return func(context.Context, Config) ([]TableInfo, error) {
+		n := calls.Add(1)
+		if fail != nil && fail.Load() {
+			return nil, errors.New("server unavailable")
+		}
+		return []TableInfo{{Name: string(rune('0' + n))}}, nil
+	}, &calls
+}
+
+func TestCatalogCacheServesCachedListing(t *testing.T) {
+	fetch, calls := countingFetch(nil)
+	c := NewCatalogCache(time.Hour, fetch)
+	cfg := Config{URI: "grpc://a"}
+
+	for i := 0; i < 3; i++ {
+		tables, err := c.Tables(context.Background(), cfg)
+		if err != nil || len(tables) != 1 || tables[0].Name != "1" {
+			t.Fatalf("Tables() = %v, %v, want the first listing", tables, err)
+		}
+	}
+	if calls.Load() != 1 {
+		t.Errorf("fetched %d times, want 1", calls.Load())
+	}
+
+	// Listings are kept per server and credentials
+	if _, err := c.Tables(context.Background(), Config{URI: "grpc://a", Username: "other"}); err != nil {
+		t.Fatal(err)
+	}
+	if calls.Load() != 2 {
+		t.Errorf("fetched %d times, want 2 after listing with other credentials", calls.Load())
+	}
+
+	c.Invalidate()
+	if tables, _ := c.Tables(context.Background(), cfg); tables[0].Name != "3" {
+		t.Errorf("after Invalidate got listing %q, want a fresh one", tables[0].Name)
+	}
+}
+
+func TestCatalogCacheRefreshesStaleListingInBackground(t *testing.T) {
+	fetch, _ := countingFetch(nil)
+	c := NewCatalogCache(time.Millisecond, fetch)
+	cfg := Config{URI: "grpc://a"}
+
+	c.Tables(context.Background(), cfg)
+	time.Sleep(5 * time.Millisecond)
+
+	// The stale listing is returned at once while the refresh runs
+	if tables, _ := c.Tables(context.Background(), cfg); tables[0].Name != "1" {
+		t.Errorf("stale call got listing %q, want the cached one", tables[0].Name)
+	}
+	deadline := time.Now().Add(time.Second)
+	for {
+		tables, _ := c.Tables(context.Background(), cfg)
+		if tables[0].Name != "1" {
+			break
+		}
+		if time.Now().After(deadline) {
+			t.Fatal("background refresh never replaced the stale listing")
+		}
+		time.Sleep(time.Millisecond)
+	}
+}
+
+func TestCatalogCacheDoesNotCacheFailures(t *testing.T) {
+	var fail atomic.Bool
+	fail.Store(true)
+	fetch, calls := countingFetch(&fail)
+	c := NewCatalogCache(time.Hour, fetch)
+	cfg := Config{URI: "grpc://a"}
+
+	if _, err := c.Tables(context.Background(), cfg); err == nil {
+		t.Fatal("expected the fetch error")
+	}
+	fail.Store(false)
+	if _, err := c.Tables(context.Background(), cfg); err != nil {
+		t.Fatalf("retry after failure: %v", err)
+	}
+	if calls.Load() != 2 {
+		t.Errorf("fetched %d times, want 2", calls.Load())
+	}
+}
+
+func TestCatalogCacheZeroTTLDisablesCache(t *testing.T) {
+	fetch, calls := countingFetch(nil)
+	c := NewCatalogCache(0, fetch)
+	for i := 0; i < 3; i++ {
+		c.Tables(context.Background(), Config{URI: "grpc://a"})
+	}
+	if calls.Load() != 3 {
+		t.Errorf("fetched %d times, want 3", calls.Load())
+	}
+}
+
+func TestCatalogCacheConcurrentFirstFetch(t *testing.T) {
+	release := make(chan struct{})
+	var calls atomic.Int32
+	c := NewCatalogCache(time.Hour, func(context.Context, Config) ([]TableInfo, error) {
+		calls.Add(1)
+		<-release
+		return []TableInfo{{Name: "t"}}, nil
+	})
+
+	const numGoroutines = 20
+	var wg sync.WaitGroup
+	wg.Add(numGoroutines)
+	for i := 0; i < numGoroutines; i++ {
+		go func() {
+			defer wg.Done()
+			if tables, err := c.Tables(context.Background(), Config{URI: "grpc://a"}); err != nil || len(tables) != 1 {
+				t.Errorf("Tables() = %v, %v", tables, err)
+			}
+		}()
+	}
+	time.Sleep(10 * time.Millisecond)
+	close(release)
+	wg.Wait()
+
+	if calls.Load() != 1 {
+		t.Errorf("fetched %d times, want 1", calls.Load())
+	}
+}
@@ -2,11 +2,18 @@ package flight
 
 import (
 	"context"
+	"errors"
 	"fmt"
+	"strconv"
+	"strings"
 	"time"
 
+	"main/internal/slowlog"
+	"main/internal/tracing"
+
 	"github.com/apache/arrow-adbc/go/adbc"
 	"github.com/apache/arrow-adbc/go/adbc/driver/flightsql"
+	"github.com/apache/arrow-go/v18/arrow"
 	"github.com/apache/arrow-go/v18/arrow/array"
 	"google.golang.org/grpc"
 	"google.golang.org/grpc/keepalive"
@@ -22,8 +29,10 @@ type Config struct {
 
 // Client wraps ADBC Flight SQL connection
 type Client struct {
-	db   adbc.Database
-	conn adbc.Connection
+	db      adbc.Database
+	conn    adbc.Connection
+	uri     string
+	onClose func() // Set by Pool to track open connections
 }
 
 // Connect establishes connection to Flight SQL server
@@ -66,7 +75,7 @@ func Connect(ctx context.Context, cfg Config) (*Client, error) {
 		return nil, fmt.Errorf("open connection: %w", err)
 	}
 
-	return &Client{db: db, conn: conn}, nil
+	return &Client{db: db, conn: conn, uri: cfg.URI}, nil
 }
 
 // QueryResult holds the reader and statement for cleanup
@@ -77,7 +86,15 @@ type QueryResult struct {
 
 // Query executes SQL and returns Arrow RecordReader
 // Note: Caller must call result.Reader.Release() and result.Stmt.Close() when done
-func (c *Client) Query(ctx context.Context, sql string) (*QueryResult, error) {
+func (c *Client) Query(ctx context.Context, sql string) (result *QueryResult, err error) {
+	span := tracing.FromContext(ctx).Span("flight.query").Arg("sql", sql)
+	start := time.Now()
+	defer func() {
+		span.Fail(err)
+		span.End()
+		c.logSlow(slowlog.KindQuery, sql, start, err)
+	}()
+
 	stmt, err := c.conn.NewStatement()
 	if err != nil {
 		return nil, fmt.Errorf("create statement: %w", err)
@@ -87,6 +104,10 @@ func (c *Client) Query(ctx context.Context, sql string) (*QueryResult, error) {
 		stmt.Close()
 		return nil, fmt.Errorf("set query: %w", err)
 	}
+	if err := c.requestBatchSize(stmt); err != nil {
+		stmt.Close()
+		return nil, fmt.Errorf("set batch size: %w", err)
+	}
 
 	reader, _, err := stmt.ExecuteQuery(ctx)
 	if err != nil {
@@ -100,10 +121,129 @@ func (c *Client) Query(ctx context.Context, sql string) (*QueryResult, error) {
 	}, nil
 }
 
+// requestBatchSize sends the preferred batch sizes for this server, if any, as
+// call headers on stmt's RPCs. Row counts are aligned to DuckDB's chunk size.
+func (c *Client) requestBatchSize(stmt adbc.Statement) error {
+	if rows := BatchRows.For(c.uri); rows > 0 {
+		if err := stmt.SetOption(flightsql.OptionRPCCallHeaderPrefix+HeaderBatchRows, strconv.FormatInt(AlignRows(rows), 10)); err != nil {
+			return err
+		}
+	}
+	if bytes := BatchBytes.For(c.uri); bytes > 0 {
+		if err := stmt.SetOption(flightsql.OptionRPCCallHeaderPrefix+HeaderBatchBytes, strconv.FormatInt(bytes, 10)); err != nil {
+			return err
+		}
+	}
+	return nil
+}
+
+// Schema returns the schema of sql's result without fetching any rows. It
+// asks the server to plan sql (GetSchema); servers that do not implement
+// GetSchema run sql wrapped to return no rows instead. Any other error, such
+// as invalid SQL, is returned.
+func (c *Client) Schema(ctx context.Context, sql string) (schema *arrow.Schema, err error) {
+	span := tracing.FromContext(ctx).Span("flight.schema").Arg("sql", sql)
+	defer func() { span.Fail(err); span.End() }()
+
+	stmt, err := c.conn.NewStatement()
+	if err != nil {
+		return nil, fmt.Errorf("create statement: %w", err)
+	}
+	defer stmt.Close()
+
+	if err := stmt.SetSqlQuery(sql); err != nil {
+		return nil, fmt.Errorf("set query: %w", err)
+	}
+	if es, ok := stmt.(adbc.StatementExecuteSchema); ok {
+		schema, err := es.ExecuteSchema(ctx)
+		if err == nil {
+			return schema, nil
+		}
+		var adbcErr adbc.Error
+		if !errors.As(err, &adbcErr) || adbcErr.Code != adbc.StatusNotImplemented {
+			return nil, fmt.Errorf("get schema: %w", err)
+		}
+	}
+
+	// The newline keeps a trailing line comment in sql from swallowing the wrapper
+	result, err := c.Query(ctx, "SELECT * FROM (\n"+sql+"\n) AS duckarrow_schema WHERE 1=0")
+	if err != nil {
+		return nil, err
+	}
+	defer result.Stmt.Close()
+	defer result.Reader.Release()
+	return result.Reader.Schema(), nil
+}
+
+// PlanInfo describes how the server plans to return a query's results.
+type PlanInfo struct {
+	Endpoints     int   // Flight endpoints (partitions) the result is split across
+	EstimatedRows int64 // Server's row estimate, or -1 if unknown
+}
+
+// Plan asks the server to plan sql without fetching any data (GetFlightInfo).
+func (c *Client) Plan(ctx context.Context, sql string) (info PlanInfo, err error) {
+	span := tracing.FromContext(ctx).Span("flight.plan").Arg("sql", sql)
+	defer func() { span.Fail(err); span.End() }()
+
+	stmt, err := c.conn.NewStatement()
+	if err != nil {
+		return PlanInfo{}, fmt.Errorf("create statement: %w", err)
+	}
+	defer stmt.Close()
+
+	if err := stmt.SetSqlQuery(sql); err != nil {
+		return PlanInfo{}, fmt.Errorf("set query: %w", err)
+	}
+
+	_, partitions, rows, err := stmt.ExecutePartitions(ctx)
+	if err != nil {
+		return PlanInfo{}, fmt.Errorf("execute partitions: %w", err)
+	}
+	return PlanInfo{Endpoints: int(partitions.NumPartitions), EstimatedRows: rows}, nil
+}
+
+// RemotePlan runs EXPLAIN on the server and returns its plan as text, one
+// result row per line with columns separated by tabs.
+func (c *Client) RemotePlan(ctx context.Context, sql string) (string, error) {
+	result, err := c.Query(ctx, "EXPLAIN "+sql)
+	if err != nil {
+		return "", err
+	}
+	defer result.Stmt.Close()
+	defer result.Reader.Release()
+
+	var lines []string
+	for result.Reader.Next() {
+		batch := result.Reader.RecordBatch()
+		for row := 0; row < int(batch.NumRows()); row++ {
+			cells := make([]string, 0, batch.NumCols())
+			for _, col := range batch.Columns() {
+				if col.IsValid(row) {
+					cells = append(cells, col.ValueStr(row))
+				}
+			}
+			lines = append(lines, strings.Join(cells, "\t"))
+		}
+	}
+	if err := result.Reader.Err(); err != nil {
+		return "", err
+	}
+	return strings.Join(lines, "\n"), nil
+}
+
 // Execute executes a non-query SQL statement (DDL/DML) and returns affected row count.
 // Use this for CREATE, DROP, INSERT, UPDATE, DELETE statements.
 // Returns -1 if the server doesn't provide affected row count.
-func (c *Client) Execute(ctx context.Context, sql string) (int64, error) {
+func (c *Client) Execute(ctx context.Context, sql string) (affected int64, err error) {
+	span := tracing.FromContext(ctx).Span("flight.execute").Arg("sql", sql)
+	start := time.Now()
+	defer func() {
+		span.Fail(err)
+		span.End()
+		c.logSlow(slowlog.KindExecute, sql, start, err)
+	}()
+
 	stmt, err := c.conn.NewStatement()
 	if err != nil {
 		return 0, fmt.Errorf("create statement: %w", err)
@@ -114,7 +254,7 @@ func (c *Client) Execute(ctx context.Context, sql string) (int64, error) {
 		return 0, fmt.Errorf("set query: %w", err)
 	}
 
-	affected, err := stmt.ExecuteUpdate(ctx)
+	affected, err = stmt.ExecuteUpdate(ctx)
 	if err != nil {
 		return 0, fmt.Errorf("execute update: %w", err)
 	}
@@ -122,6 +262,19 @@ func (c *Client) Execute(ctx context.Context, sql string) (int64, error) {
 	return affected, nil
 }
 
+// logSlow records a round trip that started at start in the slow-query log.
+func (c *Client) logSlow(kind, sql string, start time.Time, err error) {
+	if !slowlog.Default.Enabled() {
+		return
+	}
+	d := time.Since(start)
+	e := slowlog.Entry{Time: start, Kind: kind, URI: c.uri, SQL: sql, Query: d, Total: d}
+	if err != nil {
+		e.Error = err.Error()
+	}
+	slowlog.Default.Log(e)
+}
+
 // IsHealthy checks if the connection is still valid
 func (c *Client) IsHealthy() bool {
 	return c.conn != nil && c.db != nil
@@ -129,6 +282,10 @@ func (c *Client) IsHealthy() bool {
 
 // Close closes connection and database
 func (c *Client) Close() error {
+	if c.onClose != nil {
+		c.onClose()
+		c.onClose = nil
+	}
 	var errs []error
 	if c.conn != nil {
 		if err := c.conn.Close(); err != nil {
@@ -0,0 +1,141 @@
+package flight
+
+import (
+	"context"
+	"sort"
+	"sync/atomic"
+	"time"
+
+	"main/internal/stats"
+	"main/internal/tracing"
+)
+
+// poolMetrics holds the counters for one server key. They outlive the pooled
+// connection itself, so evictions and reconnects accumulate.
+type poolMetrics struct {
+	uri      string
+	username string
+
+	acquisitions       atomic.Int64 // Get calls
+	hits               atomic.Int64 // Served an idle pooled connection
+	inUseFallbacks     atomic.Int64 // Pooled connection busy, so an unpooled one was dialed
+	dials              atomic.Int64 // Connect attempts
+	dialFailures       atomic.Int64
+	staleEvictions     atomic.Int64 // Idle longer than maxIdle
+	unhealthyEvictions atomic.Int64
+	open               atomic.Int64 // Connections dialed by the pool and not yet closed
+
+	dialLatency *stats.Histogram // Milliseconds per Connect call
+	waitLatency *stats.Histogram // Milliseconds Get waited for the pool lock
+}
+
+// PoolStats is a snapshot of the pool metrics for one server key. The key is
+// identified by URI and username; the password is never exposed.
+type PoolStats struct {
+	URI      string
+	Username string
+
+	Acquisitions       int64
+	Hits               int64
+	InUseFallbacks     int64
+	Dials              int64
+	DialFailures       int64
+	StaleEvictions     int64
+	UnhealthyEvictions int64
+
+	Open   int64 // Open connections, pooled and unpooled
+	Pooled bool  // A connection for this key is currently held by the pool
+	InUse  bool  // The pooled connection is currently streaming
+
+	DialLatency stats.HistogramSnapshot // Milliseconds
+	WaitLatency stats.HistogramSnapshot // Milliseconds
+}
+
+// HitRate returns the fraction of acquisitions served from the pool.
+func (s PoolStats) HitRate() float64 {
+	if s.Acquisitions == 0 {
+		return 0
+	}
+	return float64(s.Hits) / float64(s.Acquisitions)
+}
+
+// PoolStatistics returns metrics for every server key the global pool has seen.
+func PoolStatistics() []PoolStats {
+	return globalPool.Stats()
+}
+
+// metricsFor returns the metrics for key, creating them on first use.
+// Caller must hold p.mu.
+func (p *Pool) metricsFor(key string, cfg Config) *poolMetrics {
+	m, ok := p.metrics[key]
+	if !ok {
+		m = &poolMetrics{
+			uri:         cfg.URI,
+			username:    cfg.Username,
+			dialLatency: stats.NewHistogram(stats.LatencyBounds),
+			waitLatency: stats.NewHistogram(stats.LatencyBounds),
+		}
+		p.metrics[key] = m
+	}
+	return m
+}
+
+// Stats returns metrics for every server key the pool has seen, sorted by URI
+// then username.
+func (p *Pool) Stats() []PoolStats {
+	p.mu.Lock()
+	defer p.mu.Unlock()
+
+	out := make([]PoolStats, 0, len(p.metrics))
+	for key, m := range p.metrics {
+		s := PoolStats{
+			URI:                m.uri,
+			Username:           m.username,
+			Acquisitions:       m.acquisitions.Load(),
+			Hits:               m.hits.Load(),
+			InUseFallbacks:     m.inUseFallbacks.Load(),
+			Dials:              m.dials.Load(),
+			DialFailures:       m.dialFailures.Load(),
+			StaleEvictions:     m.staleEvictions.Load(),
+			UnhealthyEvictions: m.unhealthyEvictions.Load(),
+			Open:               m.open.Load(),
+			DialLatency:        m.dialLatency.Snapshot(),
+			WaitLatency:        m.waitLatency.Snapshot(),
+		}
+		if pc, ok := p.clients[key]; ok {
+			s.Pooled = true
+			s.InUse = pc.inUse.Load()
+		}
+		out = append(out, s)
+	}
+	sort.Slice(out, func(i, j int) bool {
+		if out[i].URI != out[j].URI {
+			return out[i].URI < out[j].URI
+		}
+		return out[i].Username < out[j].Username
+	})
+	return out
+}
+
+// connect dials a new connection for the pool and records its metrics.
+func (p *Pool) connect(ctx context.Context, cfg Config, m *poolMetrics) (*Client, error) {
+	span := tracing.FromContext(ctx).Span("pool.dial").Arg("uri", cfg.URI)
+	defer span.End()
+
+	start := time.Now()
+	client, err := p.dial(ctx, cfg)
+	m.dialLatency.Observe(millis(time.Since(start)))
+	m.dials.Add(1)
+	if err != nil {
+		span.Fail(err)
+		m.dialFailures.Add(1)
+		return nil, err
+	}
+	m.open.Add(1)
+	client.onClose = func() { m.open.Add(-1) }
+	return client, nil
+}
+
+func millis(d time.Duration) float64 {
+	return float64(d) / float64(time.Millisecond)
+}
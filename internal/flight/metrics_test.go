@@ -0,0 +1,161 @@
+package flight
+
+import (
+	"context"
+	"errors"
+	"testing"
+
+	"github.com/apache/arrow-adbc/go/adbc"
+)
+
+// fakeDatabase and fakeConnection make a Client healthy without a server.
+// Only Close is implemented; any other call panics on the nil embedded interface.
+type fakeDatabase struct{ adbc.Database }
+
+func (fakeDatabase) Close() error { return nil }
+
+type fakeConnection struct{ adbc.Connection }
+
+func (fakeConnection) Close() error { return nil }
+
+func healthyDial(context.Context, Config) (*Client, error) {
+	return &Client{db: fakeDatabase{}, conn: fakeConnection{}}, nil
+}
+
+// statsFor returns the single PoolStats entry, failing if there is not exactly one.
+func statsFor(t *testing.T, pool *Pool) PoolStats {
+	t.Helper()
+	all := pool.Stats()
+	if len(all) != 1 {
+		t.Fatalf("expected stats for 1 key, got %d", len(all))
+	}
+	return all[0]
+}
+
+func TestPoolStatsHitsAndFallbacks(t *testing.T) {
+	pool := NewPool()
+	pool.dial = healthyDial
+	defer pool.Close()
+	cfg := Config{URI: "grpc://localhost:31337", Username: "user", Password: "secret"}
+	ctx := context.Background()
+
+	first, err := pool.Get(ctx, cfg) // Dial and pool
+	if err != nil {
+		t.Fatal(err)
+	}
+	second, err := pool.Get(ctx, cfg) // Pooled connection busy: unpooled dial
+	if err != nil {
+		t.Fatal(err)
+	}
+	if !first.IsPooled || second.IsPooled {
+		t.Fatalf("IsPooled = %v, %v; want true, false", first.IsPooled, second.IsPooled)
+	}
+	if got := statsFor(t, pool).Open; got != 2 {
+		t.Errorf("Open = %d, want 2 while the unpooled connection is open", got)
+	}
+	second.Client.Close()
+	pool.Release(cfg)
+	if _, err := pool.Get(ctx, cfg); err != nil { // Reuse
+		t.Fatal(err)
+	}
+
+	s := statsFor(t, pool)
+	if s.URI != cfg.URI || s.Username != cfg.Username {
+		t.Errorf("key = %s/%s, want %s/%s", s.URI, s.Username, cfg.URI, cfg.Username)
+	}
+	if s.Acquisitions != 3 || s.Hits != 1 || s.InUseFallbacks != 1 || s.Dials != 2 {
+		t.Errorf("acquisitions/hits/fallbacks/dials = %d/%d/%d/%d, want 3/1/1/2",
+			s.Acquisitions, s.Hits, s.InUseFallbacks, s.Dials)
+	}
+	if s.Open != 1 || !s.Pooled || !s.InUse {
+		t.Errorf("open/pooled/inUse = %d/%v/%v, want 1/true/true", s.Open, s.Pooled, s.InUse)
+	}
+	if s.DialLatency.Count != 2 || s.WaitLatency.Count != 3 {
+		t.Errorf("dial/wait observations = %d/%d, want 2/3", s.DialLatency.Count, s.WaitLatency.Count)
+	}
+	if got := s.HitRate(); got != 1.0/3 {
+		t.Errorf("HitRate = %v, want 1/3", got)
+	}
+
+	pool.Close()
+	if got := statsFor(t, pool).Open; got != 0 {
+		t.Errorf("Open after Close = %d, want 0", got)
+	}
+}
+
+func TestPoolStatsEvictions(t *testing.T) {
+	pool := NewPool()
+	defer pool.Close()
+	cfg := Config{URI: "grpc://localhost:31337"}
+	ctx := context.Background()
+
+	// An unhealthy pooled connection is evicted on the next Get
+	pool.dial = func(context.Context, Config) (*Client, error) { return &Client{}, nil }
+	if _, err := pool.Get(ctx, cfg); err != nil {
+		t.Fatal(err)
+	}
+	pool.Release(cfg)
+	pool.dial = healthyDial
+	if _, err := pool.Get(ctx, cfg); err != nil {
+		t.Fatal(err)
+	}
+	pool.Release(cfg)
+
+	// With no idle allowance every pooled connection is stale
+	pool.maxIdle = 0
+	if _, err := pool.Get(ctx, cfg); err != nil {
+		t.Fatal(err)
+	}
+
+	s := statsFor(t, pool)
+	if s.UnhealthyEvictions != 1 || s.StaleEvictions != 1 {
+		t.Errorf("unhealthy/stale evictions = %d/%d, want 1/1", s.UnhealthyEvictions, s.StaleEvictions)
+	}
+	if s.Dials != 3 || s.Open != 1 {
+		t.Errorf("dials/open = %d/%d, want 3/1", s.Dials, s.Open)
+	}
+}
+
+func TestPoolStatsDialFailure(t *testing.T) {
+	pool := NewPool()
+	defer pool.Close()
+	pool.dial = func(context.Context, Config) (*Client, error) { return nil, errors.New("refused") }
+
+	if _, err := pool.Get(context.Background(), Config{URI: "grpc://down:1"}); err == nil {
+		t.Fatal("expected dial error")
+	}
+
+	s := statsFor(t, pool)
+	if s.Dials != 1 || s.DialFailures != 1 || s.Open != 0 || s.Pooled {
+		t.Errorf("dials/failures/open/pooled = %d/%d/%d/%v, want 1/1/0/false",
+			s.Dials, s.DialFailures, s.Open, s.Pooled)
+	}
+}
+
+func TestPoolStatsSeparateKeys(t *testing.T) {
+	pool := NewPool()
+	pool.dial = healthyDial
+	defer pool.Close()
+	ctx := context.Background()
+
+	for _, cfg := range []Config{
+		{URI: "grpc://b:1", Username: "u"},
+		{URI: "grpc://a:1", Username: "u2"},
+		{URI: "grpc://a:1", Username: "u1"},
+	} {
+		if _, err := pool.Get(ctx, cfg); err != nil {
+			t.Fatal(err)
+		}
+	}
+
+	all := pool.Stats()
+	want := []string{"grpc://a:1/u1", "grpc://a:1/u2", "grpc://b:1/u"}
+	if len(all) != len(want) {
+		t.Fatalf("got %d keys, want %d", len(all), len(want))
+	}
+	for i, s := range all {
+		if got := s.URI + "/" + s.Username; got != want[i] {
+			t.Errorf("stats[%d] = %s, want %s", i, got, want[i])
+		}
+	}
+}
@@ -8,6 +8,8 @@ import (
 	"sync"
 	"sync/atomic"
 	"time"
+
+	"main/internal/tracing"
 )
 
 // PooledClient wraps a Client with pool metadata
@@ -22,7 +24,9 @@ type PooledClient struct {
 type Pool struct {
 	mu      sync.Mutex
 	clients map[string]*PooledClient
+	metrics map[string]*poolMetrics
 	maxIdle time.Duration
+	dial    func(context.Context, Config) (*Client, error)
 }
 
 // ConnectionResult holds a connection and whether it came from the pool
@@ -38,7 +42,9 @@ var globalPool = NewPool()
 func NewPool() *Pool {
 	return &Pool{
 		clients: make(map[string]*PooledClient),
+		metrics: make(map[string]*poolMetrics),
 		maxIdle: 5 * time.Minute, // Default idle timeout
+		dial:    Connect,
 	}
 }
 
@@ -75,14 +81,23 @@ func (p *Pool) configKey(cfg Config) string {
 // Get retrieves a connection from the pool or creates a new one
 func (p *Pool) Get(ctx context.Context, cfg Config) (*ConnectionResult, error) {
 	key := p.configKey(cfg)
+	span := tracing.FromContext(ctx).Span("pool.acquire")
+	defer span.End()
 
+	start := time.Now()
 	p.mu.Lock()
 	defer p.mu.Unlock()
 
+	m := p.metricsFor(key, cfg)
+	m.waitLatency.Observe(millis(time.Since(start)))
+	m.acquisitions.Add(1)
+
 	if pc, ok := p.clients[key]; ok {
 		// Case 1: Connection in use - create new unmanaged connection
 		if pc.inUse.Load() {
-			client, err := Connect(ctx, cfg)
+			m.inUseFallbacks.Add(1)
+			span.Arg("outcome", "in_use_fallback")
+			client, err := p.connect(ctx, cfg, m)
 			if err != nil {
 				return nil, err
 			}
@@ -93,18 +108,26 @@ func (p *Pool) Get(ctx context.Context, cfg Config) (*ConnectionResult, error) {
 		// Case 2: Connection not in use - check health and staleness
 		if pc.client.IsHealthy() && time.Since(pc.lastUsed) < p.maxIdle {
 			// Healthy and fresh - reuse
+			m.hits.Add(1)
+			span.Arg("outcome", "hit")
 			pc.inUse.Store(true)
 			pc.lastUsed = time.Now()
 			return &ConnectionResult{Client: pc.client, IsPooled: true}, nil
 		}
 
 		// Case 3: Unhealthy or stale - close and remove
+		if pc.client.IsHealthy() {
+			m.staleEvictions.Add(1)
+		} else {
+			m.unhealthyEvictions.Add(1)
+		}
 		pc.client.Close()
 		delete(p.clients, key)
 	}
 
 	// Create new connection and add to pool
-	client, err := Connect(ctx, cfg)
+	span.Arg("outcome", "dial")
+	client, err := p.connect(ctx, cfg, m)
 	if err != nil {
 		return nil, err
 	}
@@ -0,0 +1,207 @@
+package flighttest
+
+import (
+	"context"
+	"fmt"
+	"testing"
+	"time"
+
+	"main/internal/convert"
+	"main/internal/flight"
+
+	"github.com/apache/arrow-go/v18/arrow"
+)
+
+// chunkSize matches DuckDB's STANDARD_VECTOR_SIZE used by the scan.
+const chunkSize = 2048
+
+// networks are the link profiles every end-to-end benchmark runs against.
+var networks = []struct {
+	name string
+	net  Network
+}{
+	{"loopback", Network{}},
+	{"lan", Network{Latency: 500 * time.Microsecond, Bandwidth: 1 << 30 / 8}},  // 1 Gbit/s
+	{"wan", Network{Latency: 20 * time.Millisecond, Bandwidth: 100 << 20 / 8}}, // 100 Mbit/s
+}
+
+// widths are the table shapes every end-to-end benchmark runs against.
+var widths = []struct {
+	name  string
+	types []arrow.DataType
+}{
+	{"narrow", []arrow.DataType{arrow.PrimitiveTypes.Int64, arrow.PrimitiveTypes.Float64}},
+	{"mixed", []arrow.DataType{
+		arrow.PrimitiveTypes.Int64, arrow.PrimitiveTypes.Int32, arrow.PrimitiveTypes.Float64,
+		arrow.BinaryTypes.String, arrow.FixedWidthTypes.Timestamp_us, arrow.FixedWidthTypes.Date32,
+		arrow.FixedWidthTypes.Boolean, &arrow.Decimal128Type{Precision: 18, Scale: 2},
+	}},
+	{"wide", repeatTypes(64, arrow.PrimitiveTypes.Int64, arrow.BinaryTypes.String)},
+}
+
+func repeatTypes(n int, types ...arrow.DataType) []arrow.DataType {
+	out := make([]arrow.DataType, n)
+	for i := range out {
+		out[i] = types[i%len(types)]
+	}
+	return out
+}
+
+// BenchmarkBind measures the schema round trip the extension makes at bind
+// time for duckarrow.* references (SELECT * FROM "t" WHERE 1=0).
+func BenchmarkBind(b *testing.B) {
+	for _, n := range networks {
+		b.Run("net="+n.name, func(b *testing.B) {
+			_, client := startServer(b, n.net, GenerateTable("t", 1, widths[1].types...))
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				drain(b, client, `SELECT * FROM "t" WHERE 1=0`)
+			}
+		})
+	}
+}
+
+// BenchmarkTimeToFirstRow measures from issuing the scan query until the
+// first batch is converted into DuckDB vectors.
+func BenchmarkTimeToFirstRow(b *testing.B) {
+	for _, n := range networks {
+		b.Run("net="+n.name, func(b *testing.B) {
+			table := GenerateTable("t", 1<<20, widths[1].types...)
+			_, client := startServer(b, n.net, table)
+			vecs := newVectors(table.Schema)
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				result, err := client.Query(context.Background(), `SELECT * FROM "t"`)
+				if err != nil {
+					b.Fatal(err)
+				}
+				if !result.Reader.Next() {
+					b.Fatalf("no batches: %v", result.Reader.Err())
+				}
+				convertChunk(b, result.Reader.RecordBatch(), vecs, 0)
+				b.StopTimer()
+				result.Reader.Release()
+				result.Stmt.Close()
+				b.StartTimer()
+			}
+		})
+	}
+}
+
+// BenchmarkScan measures sustained throughput of a full scan: Flight
+// transfer plus conversion into DuckDB-sized vectors, as scanArrowData does.
+func BenchmarkScan(b *testing.B) {
+	const rows = 1 << 20
+	for _, n := range networks {
+		for _, w := range widths {
+			b.Run(fmt.Sprintf("net=%s/width=%s", n.name, w.name), func(b *testing.B) {
+				table := GenerateTable("t", rows, w.types...)
+				_, client := startServer(b, n.net, table)
+				vecs := newVectors(table.Schema)
+				b.ResetTimer()
+				var bytes int64
+				for i := 0; i < b.N; i++ {
+					bytes += scan(b, client, `SELECT * FROM "t"`, vecs)
+				}
+				b.SetBytes(bytes / int64(b.N))
+				b.ReportMetric(float64(rows)*float64(b.N)/b.Elapsed().Seconds(), "rows/s")
+			})
+		}
+	}
+}
+
+// BenchmarkScanProjection measures a scan that projects 2 of 64 columns,
+// the case projection pushdown exists for.
+func BenchmarkScanProjection(b *testing.B) {
+	const rows = 1 << 20
+	table := GenerateTable("t", rows, widths[2].types...)
+	_, client := startServer(b, Network{}, table)
+	projected := arrow.NewSchema([]arrow.Field{table.Schema.Field(0), table.Schema.Field(1)}, nil)
+	vecs := newVectors(projected)
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		scan(b, client, `SELECT "c0", "c1" FROM "t"`, vecs)
+	}
+	b.ReportMetric(float64(rows)*float64(b.N)/b.Elapsed().Seconds(), "rows/s")
+}
+
+// BenchmarkScanBatchRows compares a server's unaligned 5000-row batches, each
+// ending in a partial chunk, with 4096-row batches requested through batch_rows.
+func BenchmarkScanBatchRows(b *testing.B) {
+	const rows = 1 << 20
+	for _, requested := range []int64{0, 4096} {
+		b.Run(fmt.Sprintf("batch_rows=%d", requested), func(b *testing.B) {
+			table := GenerateTable("t", rows, widths[1].types...)
+			table.BatchRows = 5000
+			srv, client := startServer(b, Network{}, table)
+			if err := flight.BatchRows.Set(fmt.Sprintf("%s=%d", srv.URI(), requested)); err != nil {
+				b.Fatal(err)
+			}
+			b.Cleanup(func() { flight.BatchRows.Set("") })
+			vecs := newVectors(table.Schema)
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				scan(b, client, `SELECT * FROM "t"`, vecs)
+			}
+			b.ReportMetric(float64(rows)*float64(b.N)/b.Elapsed().Seconds(), "rows/s")
+		})
+	}
+}
+
+// scan reads a query to completion, converting every batch, and returns the
+// Arrow bytes received.
+func scan(b *testing.B, client *flight.Client, sql string, vecs []*convert.MemVector) int64 {
+	result, err := client.Query(context.Background(), sql)
+	if err != nil {
+		b.Fatal(err)
+	}
+	defer result.Stmt.Close()
+	defer result.Reader.Release()
+
+	var bytes int64
+	for result.Reader.Next() {
+		batch := result.Reader.RecordBatch()
+		for offset := int64(0); offset < batch.NumRows(); offset += chunkSize {
+			convertChunk(b, batch, vecs, int(offset))
+		}
+		for _, col := range batch.Columns() {
+			bytes += dataBytes(col.Data())
+		}
+	}
+	if err := result.Reader.Err(); err != nil {
+		b.Fatal(err)
+	}
+	return bytes
+}
+
+// convertChunk converts one DuckDB chunk of batch starting at offset.
+func convertChunk(b *testing.B, batch arrow.RecordBatch, vecs []*convert.MemVector, offset int) {
+	count := min(chunkSize, int(batch.NumRows())-offset)
+	for i, col := range batch.Columns() {
+		vecs[i].Reset()
+		if err := convert.Convert(col, vecs[i], offset, count); err != nil {
+			b.Fatal(err)
+		}
+	}
+}
+
+func newVectors(schema *arrow.Schema) []*convert.MemVector {
+	vecs := make([]*convert.MemVector, schema.NumFields())
+	for i, f := range schema.Fields() {
+		vecs[i] = convert.NewMemVector(f.Type, chunkSize)
+	}
+	return vecs
+}
+
+func dataBytes(data arrow.ArrayData) int64 {
+	var total int64
+	for _, buf := range data.Buffers() {
+		if buf != nil {
+			total += int64(buf.Len())
+		}
+	}
+	for _, child := range data.Children() {
+		total += dataBytes(child)
+	}
+	return total
+}
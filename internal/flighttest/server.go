@@ -0,0 +1,396 @@
+// Package flighttest provides an in-process Flight SQL server that serves
+// generated tables, so end-to-end tests and benchmarks can run without an
+// external GizmoSQL instance.
+//
+// The server understands the queries the extension itself issues:
+//
+//	SELECT * FROM "table"
+//	SELECT "col1", "col2" FROM "table"
+//	SELECT * FROM "table" WHERE 1=0
+//
+// It also honours the client's preferred batch sizes (the x-duckarrow-batch-*
+// headers), up to the table's BatchRows.
+package flighttest
+
+import (
+	"context"
+	"fmt"
+	"regexp"
+	"strconv"
+	"strings"
+	"sync"
+	"time"
+
+	"main/internal/arrowgen"
+
+	"github.com/apache/arrow-go/v18/arrow"
+	"github.com/apache/arrow-go/v18/arrow/array"
+	"github.com/apache/arrow-go/v18/arrow/flight"
+	"github.com/apache/arrow-go/v18/arrow/flight/flightsql"
+	"github.com/apache/arrow-go/v18/arrow/memory"
+	"google.golang.org/grpc"
+	"google.golang.org/grpc/codes"
+	"google.golang.org/grpc/metadata"
+	"google.golang.org/grpc/status"
+)
+
+// DefaultBatchRows is the number of rows per record batch when a Table does not set one.
+const DefaultBatchRows = 64 * 1024
+
+// Table describes a generated table served by the test server.
+type Table struct {
+	Name      string
+	Schema    *arrow.Schema
+	Rows      int64
+	BatchRows int              // Rows per record batch; 0 means DefaultBatchRows
+	Options   arrowgen.Options // Shape of the generated values
+}
+
+// GenerateTable describes a table with one nullable column per type, named c0, c1, ...
+func GenerateTable(name string, rows int64, types ...arrow.DataType) Table {
+	fields := make([]arrow.Field, len(types))
+	for i, t := range types {
+		fields[i] = arrow.Field{Name: fmt.Sprintf("c%d", i), Type: t, Nullable: true}
+	}
+	return Table{
+		Name:    name,
+		Schema:  arrow.NewSchema(fields, nil),
+		Rows:    rows,
+		Options: arrowgen.Options{NullFraction: 0.1, StringLen: 16, ListLen: 4},
+	}
+}
+
+// Network simulates a slower link between client and server.
+type Network struct {
+	Latency   time.Duration // Added once per RPC, like a round trip to a remote server
+	Bandwidth int64         // Bytes per second for streamed responses; 0 means unlimited
+}
+
+// Server is a loopback Flight SQL server. Create one with NewServer and
+// stop it with Close.
+type Server struct {
+	flightsql.BaseServer
+
+	network Network
+	srv     flight.Server
+
+	mu     sync.Mutex
+	tables map[string]*servedTable
+}
+
+// servedTable holds a table and its lazily generated template batch. Every
+// batch streamed for the table is a slice of the template, so generation
+// cost stays out of measurements.
+type servedTable struct {
+	Table
+	once  sync.Once
+	batch arrow.RecordBatch
+}
+
+// NewServer starts a server on a random localhost port serving tables.
+func NewServer(network Network, tables ...Table) (*Server, error) {
+	s := &Server{network: network, tables: make(map[string]*servedTable)}
+	s.Alloc = memory.DefaultAllocator
+	for _, t := range tables {
+		if t.BatchRows <= 0 {
+			t.BatchRows = DefaultBatchRows
+		}
+		s.tables[t.Name] = &servedTable{Table: t}
+	}
+
+	s.srv = flight.NewServerWithMiddleware(nil,
+		grpc.UnaryInterceptor(s.unaryInterceptor),
+		grpc.StreamInterceptor(s.streamInterceptor),
+	)
+	if err := s.srv.Init("127.0.0.1:0"); err != nil {
+		return nil, fmt.Errorf("listen: %w", err)
+	}
+	s.srv.RegisterFlightService(flightsql.NewFlightServer(s))
+	go s.srv.Serve()
+	return s, nil
+}
+
+// URI returns the address to pass as flight.Config.URI.
+func (s *Server) URI() string {
+	return "grpc://" + s.srv.Addr().String()
+}
+
+// Close stops the server and releases generated data.
+func (s *Server) Close() {
+	s.srv.Shutdown()
+	s.mu.Lock()
+	defer s.mu.Unlock()
+	for _, t := range s.tables {
+		if t.batch != nil {
+			t.batch.Release()
+			t.batch = nil
+		}
+	}
+}
+
+// GetFlightInfoStatement plans a query. The statement handle is the query
+// text itself, so the server keeps no per-query state.
+func (s *Server) GetFlightInfoStatement(ctx context.Context, cmd flightsql.StatementQuery, desc *flight.FlightDescriptor) (*flight.FlightInfo, error) {
+	q, err := s.parse(cmd.GetQuery())
+	if err != nil {
+		return nil, err
+	}
+	ticket, err := flightsql.CreateStatementQueryTicket([]byte(cmd.GetQuery()))
+	if err != nil {
+		return nil, err
+	}
+	return &flight.FlightInfo{
+		FlightDescriptor: desc,
+		Endpoint:         []*flight.FlightEndpoint{{Ticket: &flight.Ticket{Ticket: ticket}}},
+		Schema:           flight.SerializeSchema(q.schema, s.Alloc),
+		TotalRecords:     q.rows,
+		TotalBytes:       -1,
+	}, nil
+}
+
+// GetSchemaStatement returns the result schema of a query without running it.
+func (s *Server) GetSchemaStatement(ctx context.Context, cmd flightsql.StatementQuery, desc *flight.FlightDescriptor) (*flight.SchemaResult, error) {
+	q, err := s.parse(cmd.GetQuery())
+	if err != nil {
+		return nil, err
+	}
+	return &flight.SchemaResult{Schema: flight.SerializeSchema(q.schema, s.Alloc)}, nil
+}
+
+// DoGetStatement streams the generated rows for a ticket from GetFlightInfoStatement.
+func (s *Server) DoGetStatement(ctx context.Context, ticket flightsql.StatementQueryTicket) (*arrow.Schema, <-chan flight.StreamChunk, error) {
+	q, err := s.parse(string(ticket.GetStatementHandle()))
+	if err != nil {
+		return nil, nil, err
+	}
+	template := s.template(q.table)
+	batchRows := requestedBatchRows(ctx, template)
+
+	ch := make(chan flight.StreamChunk)
+	go func() {
+		defer close(ch)
+		for sent := int64(0); sent < q.rows; sent += batchRows {
+			n := min(batchRows, q.rows-sent)
+			slice := template.NewSlice(0, n)
+			cols := make([]arrow.Array, len(q.columns))
+			for i, idx := range q.columns {
+				cols[i] = slice.Column(idx)
+			}
+			rec := array.NewRecordBatch(q.schema, cols, n)
+			slice.Release()
+
+			select {
+			case ch <- flight.StreamChunk{Data: rec}:
+			case <-ctx.Done():
+				rec.Release()
+				return
+			}
+		}
+	}()
+	return q.schema, ch, nil
+}
+
+// template returns the generated batch every streamed batch is sliced from.
+func (s *Server) template(t *servedTable) arrow.RecordBatch {
+	t.once.Do(func() {
+		rows := int(min(int64(t.BatchRows), t.Rows))
+		cols := make([]arrow.Array, t.Schema.NumFields())
+		for i, field := range t.Schema.Fields() {
+			cols[i] = arrowgen.Array(field.Type, rows, t.Options, int64(i))
+		}
+		t.batch = array.NewRecordBatch(t.Schema, cols, int64(rows))
+		for _, col := range cols {
+			col.Release()
+		}
+	})
+	return t.batch
+}
+
+// requestedBatchRows returns the rows per streamed batch: the template's, or
+// fewer if the client's batch size headers ask for smaller batches.
+func requestedBatchRows(ctx context.Context, template arrow.RecordBatch) int64 {
+	n := template.NumRows()
+	md, _ := metadata.FromIncomingContext(ctx)
+	if rows := headerInt(md, "x-duckarrow-batch-rows"); rows > 0 {
+		n = min(n, rows)
+	}
+	if bytes := headerInt(md, "x-duckarrow-batch-bytes"); bytes > 0 && template.NumRows() > 0 {
+		perRow := max(1, recordBytes(template)/template.NumRows())
+		n = min(n, max(1, bytes/perRow))
+	}
+	return max(1, n)
+}
+
+// headerInt returns the integer value of gRPC header key, or 0.
+func headerInt(md metadata.MD, key string) int64 {
+	values := md.Get(key)
+	if len(values) == 0 {
+		return 0
+	}
+	n, _ := strconv.ParseInt(values[0], 10, 64)
+	return n
+}
+
+// recordBytes returns the total size of the buffers backing a record batch.
+func recordBytes(rec arrow.RecordBatch) int64 {
+	var total int64
+	var add func(data arrow.ArrayData)
+	add = func(data arrow.ArrayData) {
+		for _, buf := range data.Buffers() {
+			if buf != nil {
+				total += int64(buf.Len())
+			}
+		}
+		for _, child := range data.Children() {
+			add(child)
+		}
+	}
+	for _, col := range rec.Columns() {
+		add(col.Data())
+	}
+	return total
+}
+
+// query is a parsed SELECT against a served table.
+type query struct {
+	table   *servedTable
+	columns []int // Projected column indexes into the table schema
+	schema  *arrow.Schema
+	rows    int64
+}
+
+var selectPattern = regexp.MustCompile(`(?is)^\s*SELECT\s+(.+?)\s+FROM\s+"((?:[^"]|"")+)"(\s+WHERE\s+1\s*=\s*0)?\s*;?\s*$`)
+
+func (s *Server) parse(sql string) (*query, error) {
+	m := selectPattern.FindStringSubmatch(sql)
+	if m == nil {
+		return nil, status.Errorf(codes.InvalidArgument, "flighttest: unsupported query: %s", sql)
+	}
+	name := strings.ReplaceAll(m[2], `""`, `"`)
+	s.mu.Lock()
+	t, ok := s.tables[name]
+	s.mu.Unlock()
+	if !ok {
+		return nil, status.Errorf(codes.NotFound, "flighttest: table %q does not exist", name)
+	}
+
+	q := &query{table: t, rows: t.Rows}
+	if m[3] != "" {
+		q.rows = 0
+	}
+	if strings.TrimSpace(m[1]) == "*" {
+		q.schema = t.Schema
+		for i := range t.Schema.Fields() {
+			q.columns = append(q.columns, i)
+		}
+		return q, nil
+	}
+
+	names, err := parseColumnList(m[1])
+	if err != nil {
+		return nil, status.Errorf(codes.InvalidArgument, "flighttest: %v", err)
+	}
+	fields := make([]arrow.Field, len(names))
+	for i, col := range names {
+		indexes := t.Schema.FieldIndices(col)
+		if len(indexes) == 0 {
+			return nil, status.Errorf(codes.NotFound, "flighttest: column %q does not exist in %q", col, name)
+		}
+		q.columns = append(q.columns, indexes[0])
+		fields[i] = t.Schema.Field(indexes[0])
+	}
+	q.schema = arrow.NewSchema(fields, nil)
+	return q, nil
+}
+
+// parseColumnList parses a comma separated list of double-quoted identifiers.
+func parseColumnList(list string) ([]string, error) {
+	var names []string
+	rest := strings.TrimSpace(list)
+	for rest != "" {
+		if rest[0] != '"' {
+			return nil, fmt.Errorf("expected quoted column name at %q", rest)
+		}
+		var name strings.Builder
+		i := 1
+		for ; i < len(rest); i++ {
+			if rest[i] == '"' {
+				if i+1 < len(rest) && rest[i+1] == '"' {
+					name.WriteByte('"')
+					i++
+					continue
+				}
+				break
+			}
+			name.WriteByte(rest[i])
+		}
+		if i >= len(rest) {
+			return nil, fmt.Errorf("unterminated column name in %q", list)
+		}
+		names = append(names, name.String())
+		rest = strings.TrimSpace(rest[i+1:])
+		if rest != "" {
+			if rest[0] != ',' {
+				return nil, fmt.Errorf("expected ',' at %q", rest)
+			}
+			rest = strings.TrimSpace(rest[1:])
+		}
+	}
+	return names, nil
+}
+
+// unaryInterceptor delays unary RPCs by the simulated network latency.
+func (s *Server) unaryInterceptor(ctx context.Context, req any, info *grpc.UnaryServerInfo, handler grpc.UnaryHandler) (any, error) {
+	if err := sleepCtx(ctx, s.network.Latency); err != nil {
+		return nil, err
+	}
+	return handler(ctx, req)
+}
+
+// streamInterceptor delays streaming RPCs by the simulated network latency
+// and throttles the messages they send to the simulated bandwidth.
+func (s *Server) streamInterceptor(srv any, ss grpc.ServerStream, info *grpc.StreamServerInfo, handler grpc.StreamHandler) error {
+	if err := sleepCtx(ss.Context(), s.network.Latency); err != nil {
+		return err
+	}
+	if s.network.Bandwidth > 0 {
+		ss = &throttledStream{ServerStream: ss, bandwidth: s.network.Bandwidth}
+	}
+	return handler(srv, ss)
+}
+
+// throttledStream paces outgoing FlightData messages to a fixed byte rate.
+type throttledStream struct {
+	grpc.ServerStream
+	bandwidth int64
+	next      time.Time // Earliest time the next message may be sent
+}
+
+func (t *throttledStream) SendMsg(m any) error {
+	if data, ok := m.(*flight.FlightData); ok {
+		size := len(data.DataHeader) + len(data.DataBody) + len(data.AppMetadata)
+		now := time.Now()
+		if t.next.Before(now) {
+			t.next = now
+		}
+		t.next = t.next.Add(time.Duration(float64(size) / float64(t.bandwidth) * float64(time.Second)))
+		if err := sleepCtx(t.Context(), time.Until(t.next)); err != nil {
+			return err
+		}
+	}
+	return t.ServerStream.SendMsg(m)
+}
+
+func sleepCtx(ctx context.Context, d time.Duration) error {
+	if d <= 0 {
+		return nil
+	}
+	timer := time.NewTimer(d)
+	defer timer.Stop()
+	select {
+	case <-timer.C:
+		return nil
+	case <-ctx.Done():
+		return ctx.Err()
+	}
+}
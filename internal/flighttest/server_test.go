@@ -0,0 +1,154 @@
+package flighttest
+
+import (
+	"context"
+	"fmt"
+	"strings"
+	"testing"
+
+	"main/internal/flight"
+
+	"github.com/apache/arrow-go/v18/arrow"
+)
+
+// startServer starts a server for the test and connects a client to it.
+func startServer(t testing.TB, network Network, tables ...Table) (*Server, *flight.Client) {
+	t.Helper()
+	srv, err := NewServer(network, tables...)
+	if err != nil {
+		t.Fatalf("NewServer: %v", err)
+	}
+	t.Cleanup(srv.Close)
+
+	client, err := flight.Connect(context.Background(), flight.Config{URI: srv.URI()})
+	if err != nil {
+		t.Fatalf("Connect: %v", err)
+	}
+	t.Cleanup(func() { client.Close() })
+	return srv, client
+}
+
+// drain reads a query to completion and returns its schema and row count.
+func drain(t testing.TB, client *flight.Client, sql string) (*arrow.Schema, int64) {
+	t.Helper()
+	result, err := client.Query(context.Background(), sql)
+	if err != nil {
+		t.Fatalf("Query(%s): %v", sql, err)
+	}
+	defer result.Stmt.Close()
+	defer result.Reader.Release()
+
+	var rows int64
+	for result.Reader.Next() {
+		rows += result.Reader.RecordBatch().NumRows()
+	}
+	if err := result.Reader.Err(); err != nil {
+		t.Fatalf("read %s: %v", sql, err)
+	}
+	return result.Reader.Schema(), rows
+}
+
+func TestServerQuery(t *testing.T) {
+	table := GenerateTable("orders", 10_000, arrow.PrimitiveTypes.Int64, arrow.BinaryTypes.String, arrow.FixedWidthTypes.Timestamp_us)
+	table.BatchRows = 3_000
+	_, client := startServer(t, Network{}, table)
+
+	tests := []struct {
+		name    string
+		sql     string
+		columns []string
+		rows    int64
+	}{
+		{"all columns", `SELECT * FROM "orders"`, []string{"c0", "c1", "c2"}, 10_000},
+		{"projection", `SELECT "c2", "c0" FROM "orders"`, []string{"c2", "c0"}, 10_000},
+		{"schema only", `SELECT * FROM "orders" WHERE 1=0`, []string{"c0", "c1", "c2"}, 0},
+	}
+
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			schema, rows := drain(t, client, tt.sql)
+			if rows != tt.rows {
+				t.Errorf("rows = %d, want %d", rows, tt.rows)
+			}
+			var columns []string
+			for _, f := range schema.Fields() {
+				columns = append(columns, f.Name)
+			}
+			if strings.Join(columns, ",") != strings.Join(tt.columns, ",") {
+				t.Errorf("columns = %v, want %v", columns, tt.columns)
+			}
+		})
+	}
+}
+
+func TestServerErrors(t *testing.T) {
+	_, client := startServer(t, Network{}, GenerateTable("t", 10, arrow.PrimitiveTypes.Int32))
+
+	for _, sql := range []string{
+		`SELECT * FROM "missing"`,
+		`SELECT "nope" FROM "t"`,
+		`DELETE FROM "t"`,
+	} {
+		result, err := client.Query(context.Background(), sql)
+		if err == nil {
+			result.Reader.Release()
+			result.Stmt.Close()
+			t.Errorf("Query(%s) succeeded, want error", sql)
+		}
+	}
+}
+
+func TestParseColumnList(t *testing.T) {
+	tests := []struct {
+		input   string
+		want    []string
+		wantErr bool
+	}{
+		{`"a"`, []string{"a"}, false},
+		{`"a", "b"`, []string{"a", "b"}, false},
+		{`"we""ird", "x y"`, []string{`we"ird`, "x y"}, false},
+		{`a`, nil, true},
+		{`"a" "b"`, nil, true},
+		{`"a`, nil, true},
+	}
+
+	for _, tt := range tests {
+		got, err := parseColumnList(tt.input)
+		if (err != nil) != tt.wantErr {
+			t.Errorf("parseColumnList(%q) error = %v, wantErr %v", tt.input, err, tt.wantErr)
+			continue
+		}
+		if strings.Join(got, "|") != strings.Join(tt.want, "|") {
+			t.Errorf("parseColumnList(%q) = %q, want %q", tt.input, got, tt.want)
+		}
+	}
+}
+
+func TestServerBatchSizeHeaders(t *testing.T) {
+	table := GenerateTable("orders", 10_000, arrow.PrimitiveTypes.Int64)
+	table.BatchRows = 5_000
+	srv, client := startServer(t, Network{}, table)
+
+	// The preference applies to this server only and is aligned to full chunks
+	if err := flight.BatchRows.Set("1000, " + srv.URI() + "=3000"); err != nil {
+		t.Fatal(err)
+	}
+	t.Cleanup(func() { flight.BatchRows.Set("") })
+
+	result, err := client.Query(context.Background(), `SELECT * FROM "orders"`)
+	if err != nil {
+		t.Fatal(err)
+	}
+	defer result.Stmt.Close()
+	defer result.Reader.Release()
+	var sizes []int64
+	for result.Reader.Next() {
+		sizes = append(sizes, result.Reader.RecordBatch().NumRows())
+	}
+	if err := result.Reader.Err(); err != nil {
+		t.Fatal(err)
+	}
+	if got := fmt.Sprint(sizes); got != "[4096 4096 1808]" {
+		t.Errorf("batch rows = %s, want [4096 4096 1808]", got)
+	}
+}
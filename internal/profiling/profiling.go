@@ -0,0 +1,210 @@
+// Package profiling captures pprof profiles of the extension's Go runtime on
+// demand. The extension runs inside the DuckDB process, which has no HTTP
+// pprof endpoint or profiling hook of its own, so these are driven from SQL.
+package profiling
+
+import (
+	"errors"
+	"fmt"
+	"net"
+	"net/http"
+	"net/http/pprof"
+	"os"
+	"runtime"
+	rpprof "runtime/pprof"
+	"runtime/trace"
+	"sync"
+)
+
+// Continuous profile kinds accepted by Start.
+const (
+	CPU   = "cpu"   // pprof CPU profile
+	Trace = "trace" // Go execution trace (scheduler, GC and blocking events)
+)
+
+// Snapshot profile names accepted by WriteProfile.
+var snapshotProfiles = []string{"heap", "allocs", "goroutine", "block", "mutex", "threadcreate"}
+
+var (
+	mu sync.Mutex
+
+	// Only one continuous profile can run at a time: the Go runtime allows a
+	// single CPU profile, and running CPU and trace together skews both.
+	activeKind string
+	activePath string
+	activeFile *os.File
+
+	server     *http.Server
+	serverAddr string
+)
+
+// Start begins a continuous profile of the given kind written to a new file
+// at path. An existing file is never overwritten.
+func Start(kind, path string) error {
+	mu.Lock()
+	defer mu.Unlock()
+
+	if activeKind != "" {
+		return fmt.Errorf("%s profile already running (writing %s)", activeKind, activePath)
+	}
+	if kind != CPU && kind != Trace {
+		return fmt.Errorf("unknown profile kind %q (want %q or %q)", kind, CPU, Trace)
+	}
+	if path == "" {
+		return errors.New("path cannot be empty")
+	}
+
+	f, err := createNew(path)
+	if err != nil {
+		return err
+	}
+	if kind == CPU {
+		err = rpprof.StartCPUProfile(f)
+	} else {
+		err = trace.Start(f)
+	}
+	if err != nil {
+		f.Close()
+		os.Remove(path)
+		return err
+	}
+
+	activeKind, activePath, activeFile = kind, path, f
+	return nil
+}
+
+// Stop ends the running continuous profile and returns its kind and path.
+func Stop() (kind, path string, err error) {
+	mu.Lock()
+	defer mu.Unlock()
+
+	if activeKind == "" {
+		return "", "", errors.New("no profile running")
+	}
+	if activeKind == CPU {
+		rpprof.StopCPUProfile()
+	} else {
+		trace.Stop()
+	}
+	err = activeFile.Close()
+
+	kind, path = activeKind, activePath
+	activeKind, activePath, activeFile = "", "", nil
+	return kind, path, err
+}
+
+// Active returns the kind and path of the running continuous profile, or
+// empty strings if none is running.
+func Active() (kind, path string) {
+	mu.Lock()
+	defer mu.Unlock()
+	return activeKind, activePath
+}
+
+// WriteProfile writes a snapshot of the named runtime profile ("heap",
+// "allocs", "goroutine", "block", "mutex" or "threadcreate") to path. A
+// garbage collection runs before heap snapshots so they reflect live memory.
+// Like Start, it only creates a new file.
+func WriteProfile(name, path string) error {
+	profile := rpprof.Lookup(name)
+	if profile == nil || !isSnapshotProfile(name) {
+		return fmt.Errorf("unknown profile %q (want one of %v)", name, snapshotProfiles)
+	}
+	if path == "" {
+		return errors.New("path cannot be empty")
+	}
+
+	f, err := createNew(path)
+	if err != nil {
+		return err
+	}
+	if name == "heap" {
+		runtime.GC()
+	}
+	if err := profile.WriteTo(f, 0); err != nil {
+		f.Close()
+		return err
+	}
+	return f.Close()
+}
+
+// createNew creates the file at path, failing if it already exists. Paths
+// come from SQL, so a typo must not truncate an unrelated file.
+func createNew(path string) (*os.File, error) {
+	return os.OpenFile(path, os.O_WRONLY|os.O_CREATE|os.O_EXCL, 0o644)
+}
+
+func isSnapshotProfile(name string) bool {
+	for _, p := range snapshotProfiles {
+		if p == name {
+			return true
+		}
+	}
+	return false
+}
+
+// Listen serves net/http/pprof on addr, which must be a loopback address.
+// A missing host (":6060") binds to 127.0.0.1. Returns the bound address.
+func Listen(addr string) (string, error) {
+	mu.Lock()
+	defer mu.Unlock()
+
+	if server != nil {
+		return "", fmt.Errorf("pprof listener already running on %s", serverAddr)
+	}
+	addr, err := loopbackAddr(addr)
+	if err != nil {
+		return "", err
+	}
+
+	ln, err := net.Listen("tcp", addr)
+	if err != nil {
+		return "", err
+	}
+
+	// A private mux so nothing registered on http.DefaultServeMux is exposed
+	mux := http.NewServeMux()
+	mux.HandleFunc("/debug/pprof/", pprof.Index)
+	mux.HandleFunc("/debug/pprof/cmdline", pprof.Cmdline)
+	mux.HandleFunc("/debug/pprof/profile", pprof.Profile)
+	mux.HandleFunc("/debug/pprof/symbol", pprof.Symbol)
+	mux.HandleFunc("/debug/pprof/trace", pprof.Trace)
+
+	server = &http.Server{Handler: mux}
+	serverAddr = ln.Addr().String()
+	go server.Serve(ln)
+	return serverAddr, nil
+}
+
+// CloseListener stops the pprof listener started by Listen.
+func CloseListener() error {
+	mu.Lock()
+	defer mu.Unlock()
+
+	if server == nil {
+		return errors.New("no pprof listener running")
+	}
+	err := server.Close()
+	server, serverAddr = nil, ""
+	return err
+}
+
+// loopbackAddr validates that addr binds to a loopback interface, filling in
+// 127.0.0.1 when the host is missing.
+func loopbackAddr(addr string) (string, error) {
+	host, port, err := net.SplitHostPort(addr)
+	if err != nil {
+		return "", fmt.Errorf("invalid listen address %q: %w", addr, err)
+	}
+	switch host {
+	case "":
+		host = "127.0.0.1"
+	case "localhost":
+	default:
+		ip := net.ParseIP(host)
+		if ip == nil || !ip.IsLoopback() {
+			return "", fmt.Errorf("pprof listener must bind to a loopback address, got %q", host)
+		}
+	}
+	return net.JoinHostPort(host, port), nil
+}
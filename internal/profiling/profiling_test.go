@@ -0,0 +1,147 @@
+package profiling
+
+import (
+	"io"
+	"net/http"
+	"os"
+	"path/filepath"
+	"strings"
+	"testing"
+)
+
+func TestStartStop(t *testing.T) {
+	for _, kind := range []string{CPU, Trace} {
+		t.Run(kind, func(t *testing.T) {
+			path := filepath.Join(t.TempDir(), kind+".out")
+			if err := Start(kind, path); err != nil {
+				t.Fatalf("Start: %v", err)
+			}
+			if k, p := Active(); k != kind || p != path {
+				t.Errorf("Active() = %q, %q; want %q, %q", k, p, kind, path)
+			}
+			if err := Start(kind, path+".2"); err == nil {
+				t.Error("second Start should fail while a profile is running")
+			}
+
+			gotKind, gotPath, err := Stop()
+			if err != nil {
+				t.Fatalf("Stop: %v", err)
+			}
+			if gotKind != kind || gotPath != path {
+				t.Errorf("Stop() = %q, %q; want %q, %q", gotKind, gotPath, kind, path)
+			}
+			if info, err := os.Stat(path); err != nil || info.Size() == 0 {
+				t.Errorf("expected non-empty profile at %s (err %v)", path, err)
+			}
+		})
+	}
+}
+
+func TestStartErrors(t *testing.T) {
+	dir := t.TempDir()
+	existing := filepath.Join(dir, "existing")
+	if err := os.WriteFile(existing, []byte("keep"), 0o644); err != nil {
+		t.Fatal(err)
+	}
+	tests := []struct {
+		name string
+		kind string
+		path string
+	}{
+		{"unknown kind", "memory", filepath.Join(dir, "x")},
+		{"empty path", CPU, ""},
+		{"missing directory", CPU, filepath.Join(dir, "missing", "cpu.out")},
+		{"existing file", CPU, existing},
+	}
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			if err := Start(tt.kind, tt.path); err == nil {
+				Stop()
+				t.Error("expected error")
+			}
+		})
+	}
+
+	if _, _, err := Stop(); err == nil {
+		t.Error("Stop without a running profile should fail")
+	}
+	if data, err := os.ReadFile(existing); err != nil || string(data) != "keep" {
+		t.Errorf("existing file was modified: %q (err %v)", data, err)
+	}
+}
+
+func TestWriteProfile(t *testing.T) {
+	dir := t.TempDir()
+	for _, name := range []string{"heap", "goroutine"} {
+		path := filepath.Join(dir, name+".pb.gz")
+		if err := WriteProfile(name, path); err != nil {
+			t.Fatalf("WriteProfile(%s): %v", name, err)
+		}
+		if info, err := os.Stat(path); err != nil || info.Size() == 0 {
+			t.Errorf("expected non-empty %s profile (err %v)", name, err)
+		}
+	}
+
+	if err := WriteProfile("cpu", filepath.Join(dir, "cpu")); err == nil {
+		t.Error("cpu is not a snapshot profile")
+	}
+	if err := WriteProfile("heap", filepath.Join(dir, "heap.pb.gz")); err == nil {
+		t.Error("WriteProfile should not overwrite an existing file")
+	}
+}
+
+func TestLoopbackAddr(t *testing.T) {
+	tests := []struct {
+		addr    string
+		want    string
+		wantErr bool
+	}{
+		{":6060", "127.0.0.1:6060", false},
+		{"localhost:6060", "localhost:6060", false},
+		{"127.0.0.1:0", "127.0.0.1:0", false},
+		{"[::1]:6060", "[::1]:6060", false},
+		{"0.0.0.0:6060", "", true},
+		{"10.0.0.5:6060", "", true},
+		{"example.com:6060", "", true},
+		{"6060", "", true},
+	}
+	for _, tt := range tests {
+		got, err := loopbackAddr(tt.addr)
+		if (err != nil) != tt.wantErr {
+			t.Errorf("loopbackAddr(%q) error = %v, wantErr %v", tt.addr, err, tt.wantErr)
+			continue
+		}
+		if got != tt.want {
+			t.Errorf("loopbackAddr(%q) = %q, want %q", tt.addr, got, tt.want)
+		}
+	}
+}
+
+func TestListen(t *testing.T) {
+	addr, err := Listen("127.0.0.1:0")
+	if err != nil {
+		t.Fatalf("Listen: %v", err)
+	}
+	defer CloseListener()
+
+	if _, err := Listen("127.0.0.1:0"); err == nil {
+		t.Error("second Listen should fail")
+	}
+
+	resp, err := http.Get("http://" + addr + "/debug/pprof/")
+	if err != nil {
+		t.Fatalf("GET: %v", err)
+	}
+	body, _ := io.ReadAll(resp.Body)
+	resp.Body.Close()
+	if resp.StatusCode != http.StatusOK || !strings.Contains(string(body), "goroutine") {
+		t.Errorf("pprof index: status %d, body %.80q", resp.StatusCode, body)
+	}
+
+	if err := CloseListener(); err != nil {
+		t.Fatalf("CloseListener: %v", err)
+	}
+	if err := CloseListener(); err == nil {
+		t.Error("second CloseListener should fail")
+	}
+}
@@ -0,0 +1,107 @@
+// Package settings holds the extension's named runtime options, changed from
+// SQL with duckarrow_set(name, value) and listed by duckarrow_settings().
+// Each option owns its state through Get and Set callbacks, so this package
+// only does lookup and validation plumbing.
+package settings
+
+import (
+	"fmt"
+	"sort"
+	"strconv"
+	"strings"
+	"sync"
+)
+
+// Setting is one named option.
+type Setting struct {
+	Name        string
+	Description string
+	Default     string
+	Get         func() string
+	Set         func(value string) error
+}
+
+// Registry is a set of settings. It is safe for concurrent use.
+type Registry struct {
+	mu       sync.Mutex
+	settings map[string]*Setting
+}
+
+// Default is the registry used by the extension.
+var Default = NewRegistry()
+
+// NewRegistry creates an empty registry.
+func NewRegistry() *Registry {
+	return &Registry{settings: make(map[string]*Setting)}
+}
+
+// Define adds a setting. It panics on a duplicate name, which is a programming error.
+func (r *Registry) Define(s Setting) {
+	r.mu.Lock()
+	defer r.mu.Unlock()
+	name := strings.ToLower(s.Name)
+	if _, ok := r.settings[name]; ok {
+		panic("settings: duplicate setting " + s.Name)
+	}
+	r.settings[name] = &s
+}
+
+// Set changes a setting by case-insensitive name. An empty value or
+// "default" restores the setting's default.
+func (r *Registry) Set(name, value string) error {
+	r.mu.Lock()
+	s, ok := r.settings[strings.ToLower(strings.TrimSpace(name))]
+	r.mu.Unlock()
+	if !ok {
+		return fmt.Errorf("unknown setting %q (see duckarrow_settings())", name)
+	}
+	value = strings.TrimSpace(value)
+	if value == "" || strings.EqualFold(value, "default") {
+		value = s.Default
+	}
+	if err := s.Set(value); err != nil {
+		return fmt.Errorf("%s: %w", s.Name, err)
+	}
+	return nil
+}
+
+// Get returns the current value of a setting.
+func (r *Registry) Get(name string) (string, error) {
+	r.mu.Lock()
+	s, ok := r.settings[strings.ToLower(strings.TrimSpace(name))]
+	r.mu.Unlock()
+	if !ok {
+		return "", fmt.Errorf("unknown setting %q (see duckarrow_settings())", name)
+	}
+	return s.Get(), nil
+}
+
+// All returns every setting sorted by name.
+func (r *Registry) All() []*Setting {
+	r.mu.Lock()
+	defer r.mu.Unlock()
+	out := make([]*Setting, 0, len(r.settings))
+	for _, s := range r.settings {
+		out = append(out, s)
+	}
+	sort.Slice(out, func(i, j int) bool { return out[i].Name < out[j].Name })
+	return out
+}
+
+// ParseNonNegative parses an integer that is zero or greater.
+func ParseNonNegative(value string) (int64, error) {
+	n, err := strconv.ParseInt(value, 10, 64)
+	if err != nil || n < 0 {
+		return 0, fmt.Errorf("expected a non-negative integer, got %q", value)
+	}
+	return n, nil
+}
+
+// ParseFraction parses a number between 0 and 1 inclusive.
+func ParseFraction(value string) (float64, error) {
+	f, err := strconv.ParseFloat(value, 64)
+	if err != nil || f < 0 || f > 1 {
+		return 0, fmt.Errorf("expected a number between 0 and 1, got %q", value)
+	}
+	return f, nil
+}
@@ -0,0 +1,115 @@
+package settings
+
+import (
+	"fmt"
+	"strconv"
+	"testing"
+)
+
+// intSetting defines a non-negative integer setting backed by *v.
+func intSetting(r *Registry, name string, v *int) {
+	r.Define(Setting{
+		Name:    name,
+		Default: "10",
+		Get:     func() string { return strconv.Itoa(*v) },
+		Set: func(value string) error {
+			n, err := strconv.Atoi(value)
+			if err != nil || n < 0 {
+				return fmt.Errorf("expected a non-negative integer, got %q", value)
+			}
+			*v = n
+			return nil
+		},
+	})
+}
+
+func TestRegistrySetGet(t *testing.T) {
+	r := NewRegistry()
+	v := 10
+	intSetting(r, "batch_rows", &v)
+
+	tests := []struct {
+		name    string
+		input   string
+		value   string
+		want    int
+		wantErr bool
+	}{
+		{"plain", "batch_rows", "42", 42, false},
+		{"case insensitive", "Batch_Rows", " 7 ", 7, false},
+		{"default keyword", "batch_rows", "DEFAULT", 10, false},
+		{"empty restores default", "batch_rows", "", 10, false},
+		{"invalid value", "batch_rows", "-1", 10, true},
+		{"unknown setting", "nope", "1", 10, true},
+	}
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			err := r.Set(tt.input, tt.value)
+			if (err != nil) != tt.wantErr {
+				t.Fatalf("Set(%q, %q) error = %v, wantErr %v", tt.input, tt.value, err, tt.wantErr)
+			}
+			if v != tt.want {
+				t.Errorf("value = %d, want %d", v, tt.want)
+			}
+		})
+	}
+
+	if got, err := r.Get("BATCH_ROWS"); err != nil || got != "10" {
+		t.Errorf("Get = %q, %v; want 10", got, err)
+	}
+	if _, err := r.Get("nope"); err == nil {
+		t.Error("Get of an unknown setting should fail")
+	}
+}
+
+func TestRegistryAllSorted(t *testing.T) {
+	r := NewRegistry()
+	var a, b, c int
+	intSetting(r, "zeta", &a)
+	intSetting(r, "alpha", &b)
+	intSetting(r, "mid", &c)
+
+	var names []string
+	for _, s := range r.All() {
+		names = append(names, s.Name)
+	}
+	if fmt.Sprint(names) != "[alpha mid zeta]" {
+		t.Errorf("All() = %v, want sorted", names)
+	}
+}
+
+func TestRegistryDuplicatePanics(t *testing.T) {
+	r := NewRegistry()
+	var v int
+	intSetting(r, "x", &v)
+	defer func() {
+		if recover() == nil {
+			t.Error("duplicate Define should panic")
+		}
+	}()
+	intSetting(r, "X", &v)
+}
+
+func TestParseNonNegative(t *testing.T) {
+	if n, err := ParseNonNegative("1048576"); err != nil || n != 1048576 {
+		t.Errorf("ParseNonNegative(1048576) = %d, %v", n, err)
+	}
+	for _, bad := range []string{"-1", "1.5", "1MB", ""} {
+		if _, err := ParseNonNegative(bad); err == nil {
+			t.Errorf("ParseNonNegative(%q) should fail", bad)
+		}
+	}
+}
+
+func TestParseFraction(t *testing.T) {
+	for _, ok := range []string{"0", "1", "0.25"} {
+		if _, err := ParseFraction(ok); err != nil {
+			t.Errorf("ParseFraction(%q) = %v", ok, err)
+		}
+	}
+	for _, bad := range []string{"-0.1", "1.01", "half", ""} {
+		if _, err := ParseFraction(bad); err == nil {
+			t.Errorf("ParseFraction(%q) should fail", bad)
+		}
+	}
+}
@@ -0,0 +1,213 @@
+// Package slowlog writes remote operations that cross a time or size
+// threshold to a local JSON Lines file, one object per operation, so
+// expensive dashboard queries can be found with grep or jq after the fact.
+//
+// The log is disabled until Open is called. Thresholds are independent: an
+// entry is slow if any enabled threshold is reached, and a zero threshold is
+// disabled. Slow entries are then sampled at the configured rate.
+package slowlog
+
+import (
+	"encoding/json"
+	"errors"
+	"fmt"
+	"math/rand"
+	"os"
+	"sync"
+	"time"
+)
+
+// Operation kinds.
+const (
+	KindScan    = "scan"    // Full table function lifecycle, bind to release
+	KindQuery   = "query"   // Client.Query round trip, until the stream is open
+	KindExecute = "execute" // Client.Execute (DDL/DML)
+)
+
+// Entry is one remote operation. Durations are written in milliseconds.
+type Entry struct {
+	Time    time.Time `json:"time"`
+	Kind    string    `json:"kind"`
+	URI     string    `json:"uri,omitempty"`
+	SQL     string    `json:"sql"`
+	Columns []string  `json:"columns,omitempty"` // Projection pushed to the server; absent means all
+	Rows    int64     `json:"rows,omitempty"`
+	Bytes   int64     `json:"bytes,omitempty"`
+	Batches int64     `json:"batches,omitempty"`
+
+	Bind       time.Duration `json:"-"`
+	Query      time.Duration `json:"-"`
+	FirstBatch time.Duration `json:"-"`
+	Fetch      time.Duration `json:"-"`
+	Convert    time.Duration `json:"-"`
+	Total      time.Duration `json:"-"`
+
+	Error string `json:"error,omitempty"`
+}
+
+// MarshalJSON writes the phase timings as fractional milliseconds.
+func (e Entry) MarshalJSON() ([]byte, error) {
+	type plain Entry
+	return json.Marshal(struct {
+		plain
+		BindMs       float64 `json:"bind_ms,omitempty"`
+		QueryMs      float64 `json:"query_ms,omitempty"`
+		FirstBatchMs float64 `json:"first_batch_ms,omitempty"`
+		FetchMs      float64 `json:"fetch_ms,omitempty"`
+		ConvertMs    float64 `json:"convert_ms,omitempty"`
+		TotalMs      float64 `json:"total_ms"`
+	}{
+		plain(e),
+		millis(e.Bind), millis(e.Query), millis(e.FirstBatch),
+		millis(e.Fetch), millis(e.Convert), millis(e.Total),
+	})
+}
+
+func millis(d time.Duration) float64 {
+	return float64(d) / float64(time.Millisecond)
+}
+
+// Thresholds select which operations are slow. Zero disables a threshold.
+type Thresholds struct {
+	Total      time.Duration
+	FirstBatch time.Duration
+	Bytes      int64
+}
+
+// Slow reports whether e reaches any enabled threshold.
+func (t Thresholds) Slow(e Entry) bool {
+	return (t.Total > 0 && e.Total >= t.Total) ||
+		(t.FirstBatch > 0 && e.FirstBatch >= t.FirstBatch) ||
+		(t.Bytes > 0 && e.Bytes >= t.Bytes)
+}
+
+// Logger writes slow operations to a file. It is safe for concurrent use.
+type Logger struct {
+	mu         sync.Mutex
+	path       string
+	file       *os.File
+	thresholds Thresholds
+	rate       float64
+	rng        *rand.Rand
+}
+
+// Default is the logger used by the extension. It is disabled until Open is called.
+var Default = New()
+
+// New creates a disabled logger with a 1 second total time threshold that
+// logs every slow operation once opened.
+func New() *Logger {
+	return &Logger{
+		thresholds: Thresholds{Total: time.Second},
+		rate:       1,
+		rng:        rand.New(rand.NewSource(time.Now().UnixNano())),
+	}
+}
+
+// Open starts appending entries to path, replacing any file already open.
+// An empty path disables the log.
+func (l *Logger) Open(path string) error {
+	l.mu.Lock()
+	defer l.mu.Unlock()
+
+	if err := l.closeLocked(); err != nil {
+		return err
+	}
+	if path == "" {
+		return nil
+	}
+	f, err := os.OpenFile(path, os.O_CREATE|os.O_WRONLY|os.O_APPEND, 0o644)
+	if err != nil {
+		return err
+	}
+	l.path, l.file = path, f
+	return nil
+}
+
+// Close closes the log file.
+func (l *Logger) Close() error {
+	l.mu.Lock()
+	defer l.mu.Unlock()
+	return l.closeLocked()
+}
+
+func (l *Logger) closeLocked() error {
+	if l.file == nil {
+		return nil
+	}
+	err := l.file.Close()
+	l.path, l.file = "", nil
+	return err
+}
+
+// Path returns the current log file, or "" if the log is disabled.
+func (l *Logger) Path() string {
+	l.mu.Lock()
+	defer l.mu.Unlock()
+	return l.path
+}
+
+// Enabled reports whether a log file is open, letting callers skip building
+// entries when nothing would be written.
+func (l *Logger) Enabled() bool {
+	l.mu.Lock()
+	defer l.mu.Unlock()
+	return l.file != nil
+}
+
+// SetThresholds replaces the thresholds.
+func (l *Logger) SetThresholds(t Thresholds) error {
+	if t.Total < 0 || t.FirstBatch < 0 || t.Bytes < 0 {
+		return errors.New("thresholds must not be negative")
+	}
+	l.mu.Lock()
+	defer l.mu.Unlock()
+	l.thresholds = t
+	return nil
+}
+
+// Thresholds returns the current thresholds.
+func (l *Logger) Thresholds() Thresholds {
+	l.mu.Lock()
+	defer l.mu.Unlock()
+	return l.thresholds
+}
+
+// SetSampleRate sets the fraction of slow operations logged, between 0 and 1.
+func (l *Logger) SetSampleRate(rate float64) error {
+	if rate < 0 || rate > 1 {
+		return fmt.Errorf("sample rate must be between 0 and 1, got %v", rate)
+	}
+	l.mu.Lock()
+	defer l.mu.Unlock()
+	l.rate = rate
+	return nil
+}
+
+// SampleRate returns the fraction of slow operations logged.
+func (l *Logger) SampleRate() float64 {
+	l.mu.Lock()
+	defer l.mu.Unlock()
+	return l.rate
+}
+
+// Log writes e if the log is open, e is slow and it is sampled. It reports
+// whether e was written. A zero Time is set to now.
+func (l *Logger) Log(e Entry) bool {
+	l.mu.Lock()
+	defer l.mu.Unlock()
+
+	if l.file == nil || !l.thresholds.Slow(e) || (l.rate < 1 && l.rng.Float64() >= l.rate) {
+		return false
+	}
+	if e.Time.IsZero() {
+		e.Time = time.Now()
+	}
+	data, err := json.Marshal(e)
+	if err != nil {
+		return false
+	}
+	// One unbuffered write per line keeps the file readable while it grows
+	_, err = l.file.Write(append(data, '\n'))
+	return err == nil
+}
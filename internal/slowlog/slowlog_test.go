@@ -0,0 +1,147 @@
+package slowlog
+
+import (
+	"bufio"
+	"encoding/json"
+	"os"
+	"path/filepath"
+	"sync"
+	"testing"
+	"time"
+)
+
+// readLines parses every line of a log file.
+func readLines(t *testing.T, path string) []map[string]any {
+	t.Helper()
+	f, err := os.Open(path)
+	if err != nil {
+		t.Fatal(err)
+	}
+	defer f.Close()
+	var lines []map[string]any
+	scanner := bufio.NewScanner(f)
+	for scanner.Scan() {
+		var m map[string]any
+		if err := json.Unmarshal(scanner.Bytes(), &m); err != nil {
+			t.Fatalf("line is not JSON: %v\n%s", err, scanner.Text())
+		}
+		lines = append(lines, m)
+	}
+	return lines
+}
+
+func TestThresholds(t *testing.T) {
+	th := Thresholds{Total: time.Second, FirstBatch: 100 * time.Millisecond, Bytes: 1 << 20}
+	tests := []struct {
+		name  string
+		entry Entry
+		want  bool
+	}{
+		{"fast", Entry{Total: 10 * time.Millisecond, FirstBatch: time.Millisecond, Bytes: 100}, false},
+		{"total", Entry{Total: time.Second}, true},
+		{"first batch", Entry{Total: 200 * time.Millisecond, FirstBatch: 150 * time.Millisecond}, true},
+		{"bytes", Entry{Bytes: 2 << 20}, true},
+	}
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			if got := th.Slow(tt.entry); got != tt.want {
+				t.Errorf("Slow = %v, want %v", got, tt.want)
+			}
+		})
+	}
+	if (Thresholds{}).Slow(Entry{Total: time.Hour, Bytes: 1 << 40}) {
+		t.Error("zero thresholds should never match")
+	}
+}
+
+func TestLogWritesSlowEntries(t *testing.T) {
+	path := filepath.Join(t.TempDir(), "slow.jsonl")
+	l := New()
+	if l.Log(Entry{Total: time.Hour}) {
+		t.Error("Log on a closed logger should not write")
+	}
+	if err := l.Open(path); err != nil {
+		t.Fatal(err)
+	}
+	if err := l.SetThresholds(Thresholds{Total: 50 * time.Millisecond}); err != nil {
+		t.Fatal(err)
+	}
+
+	l.Log(Entry{Kind: KindQuery, SQL: "SELECT 1", Total: time.Millisecond})
+	l.Log(Entry{
+		Kind: KindScan, URI: "grpc://localhost:31337", SQL: `SELECT "id" FROM "Orders"`,
+		Columns: []string{"id"}, Rows: 10, Bytes: 80, Batches: 1,
+		FirstBatch: 60 * time.Millisecond, Total: 150 * time.Millisecond,
+		Error: "boom",
+	})
+	if err := l.Close(); err != nil {
+		t.Fatal(err)
+	}
+
+	lines := readLines(t, path)
+	if len(lines) != 1 {
+		t.Fatalf("got %d lines, want 1", len(lines))
+	}
+	e := lines[0]
+	if e["kind"] != KindScan || e["error"] != "boom" || e["rows"] != float64(10) {
+		t.Errorf("entry = %v", e)
+	}
+	if e["total_ms"] != float64(150) || e["first_batch_ms"] != float64(60) {
+		t.Errorf("timings = total %v, first batch %v", e["total_ms"], e["first_batch_ms"])
+	}
+	if _, ok := e["bind_ms"]; ok {
+		t.Error("zero phases should be omitted")
+	}
+	if _, ok := e["time"]; !ok {
+		t.Error("entry should have a timestamp")
+	}
+}
+
+func TestSampling(t *testing.T) {
+	l := New()
+	if err := l.Open(filepath.Join(t.TempDir(), "slow.jsonl")); err != nil {
+		t.Fatal(err)
+	}
+	defer l.Close()
+	if err := l.SetSampleRate(0); err != nil {
+		t.Fatal(err)
+	}
+	if l.Log(Entry{Total: time.Hour}) {
+		t.Error("sample rate 0 should drop every entry")
+	}
+	for _, rate := range []float64{-0.5, 2} {
+		if err := l.SetSampleRate(rate); err == nil {
+			t.Errorf("SetSampleRate(%v) should fail", rate)
+		}
+	}
+	if err := l.SetThresholds(Thresholds{Bytes: -1}); err == nil {
+		t.Error("negative thresholds should be rejected")
+	}
+}
+
+func TestReopenAppendsConcurrently(t *testing.T) {
+	path := filepath.Join(t.TempDir(), "slow.jsonl")
+	l := New()
+	for round := 0; round < 2; round++ {
+		if err := l.Open(path); err != nil {
+			t.Fatal(err)
+		}
+		var wg sync.WaitGroup
+		for i := 0; i < 8; i++ {
+			wg.Add(1)
+			go func() {
+				defer wg.Done()
+				for j := 0; j < 25; j++ {
+					l.Log(Entry{Kind: KindExecute, SQL: "DROP TABLE t", Total: 2 * time.Second})
+				}
+			}()
+		}
+		wg.Wait()
+	}
+	if err := l.Open(""); err != nil || l.Path() != "" || l.Enabled() {
+		t.Errorf("Open(\"\") should disable the log: err %v, path %q", err, l.Path())
+	}
+	if got := len(readLines(t, path)); got != 2*8*25 {
+		t.Errorf("got %d lines, want %d (reopening must append)", got, 2*8*25)
+	}
+}
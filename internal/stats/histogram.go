@@ -0,0 +1,121 @@
+package stats
+
+import (
+	"math"
+	"sync"
+)
+
+// Histogram counts observations in fixed buckets. It is safe for concurrent use.
+type Histogram struct {
+	mu     sync.Mutex
+	bounds []float64 // Inclusive upper bound of each bucket, ascending
+	counts []int64   // len(bounds)+1; the last bucket holds values above every bound
+	count  int64
+	sum    float64
+	min    float64
+	max    float64
+}
+
+// HistogramSnapshot is a point-in-time copy of a Histogram.
+type HistogramSnapshot struct {
+	Bounds []float64
+	Counts []int64
+	Count  int64
+	Sum    float64
+	Min    float64
+	Max    float64
+}
+
+// ExponentialBounds returns n bucket bounds starting at start, each factor
+// times the previous one.
+func ExponentialBounds(start, factor float64, n int) []float64 {
+	bounds := make([]float64, n)
+	for i := range bounds {
+		bounds[i] = start
+		start *= factor
+	}
+	return bounds
+}
+
+// LatencyBounds are bucket bounds in milliseconds from 50µs to about 26s.
+var LatencyBounds = ExponentialBounds(0.05, 2, 20)
+
+// NewHistogram creates a histogram with the given ascending bucket bounds.
+func NewHistogram(bounds []float64) *Histogram {
+	return &Histogram{bounds: bounds, counts: make([]int64, len(bounds)+1)}
+}
+
+// Observe records one value.
+func (h *Histogram) Observe(v float64) {
+	// Buckets are few, so a linear scan beats sort.SearchFloat64s here
+	i := 0
+	for i < len(h.bounds) && v > h.bounds[i] {
+		i++
+	}
+
+	h.mu.Lock()
+	defer h.mu.Unlock()
+	h.counts[i]++
+	if h.count == 0 || v < h.min {
+		h.min = v
+	}
+	if h.count == 0 || v > h.max {
+		h.max = v
+	}
+	h.count++
+	h.sum += v
+}
+
+// Reset discards all observations.
+func (h *Histogram) Reset() {
+	h.mu.Lock()
+	defer h.mu.Unlock()
+	clear(h.counts)
+	h.count, h.sum, h.min, h.max = 0, 0, 0, 0
+}
+
+// Snapshot returns a copy of the histogram's current state.
+func (h *Histogram) Snapshot() HistogramSnapshot {
+	h.mu.Lock()
+	defer h.mu.Unlock()
+	return HistogramSnapshot{
+		Bounds: h.bounds,
+		Counts: append([]int64(nil), h.counts...),
+		Count:  h.count,
+		Sum:    h.sum,
+		Min:    h.min,
+		Max:    h.max,
+	}
+}
+
+// Mean returns the average observation, or 0 if there are none.
+func (s HistogramSnapshot) Mean() float64 {
+	if s.Count == 0 {
+		return 0
+	}
+	return s.Sum / float64(s.Count)
+}
+
+// Quantile estimates the q-th quantile (0 <= q <= 1) as the upper bound of
+// the bucket containing it, clamped to the observed range. Returns 0 if
+// there are no observations.
+func (s HistogramSnapshot) Quantile(q float64) float64 {
+	if s.Count == 0 {
+		return 0
+	}
+	if q <= 0 {
+		return s.Min
+	}
+	rank := int64(math.Ceil(q * float64(s.Count)))
+	var seen int64
+	for i, c := range s.Counts {
+		seen += c
+		if seen >= rank && c > 0 {
+			if i == len(s.Bounds) {
+				return s.Max
+			}
+			return math.Max(s.Min, math.Min(s.Bounds[i], s.Max))
+		}
+	}
+	return s.Max
+}
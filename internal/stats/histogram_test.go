@@ -0,0 +1,84 @@
+package stats
+
+import (
+	"sync"
+	"testing"
+)
+
+func TestHistogramBuckets(t *testing.T) {
+	h := NewHistogram([]float64{1, 2, 4})
+	for _, v := range []float64{0.5, 1, 1.5, 3, 100} {
+		h.Observe(v)
+	}
+
+	s := h.Snapshot()
+	want := []int64{2, 1, 1, 1}
+	for i, c := range want {
+		if s.Counts[i] != c {
+			t.Errorf("bucket %d = %d, want %d", i, s.Counts[i], c)
+		}
+	}
+	if s.Count != 5 || s.Min != 0.5 || s.Max != 100 {
+		t.Errorf("count/min/max = %d/%v/%v, want 5/0.5/100", s.Count, s.Min, s.Max)
+	}
+	if got := s.Mean(); got != 106.0/5 {
+		t.Errorf("mean = %v, want %v", got, 106.0/5)
+	}
+}
+
+func TestHistogramQuantile(t *testing.T) {
+	h := NewHistogram(ExponentialBounds(1, 2, 8)) // 1, 2, 4, ..., 128
+	for i := 0; i < 90; i++ {
+		h.Observe(3)
+	}
+	for i := 0; i < 10; i++ {
+		h.Observe(50)
+	}
+
+	s := h.Snapshot()
+	tests := []struct {
+		q    float64
+		want float64
+	}{
+		{0, 3},     // Clamped to the minimum
+		{0.5, 4},   // Upper bound of the (2, 4] bucket
+		{0.9, 4},   // Still inside the first populated bucket
+		{0.95, 50}, // (32, 64] bucket, clamped to the maximum
+		{1, 50},
+	}
+	for _, tt := range tests {
+		if got := s.Quantile(tt.q); got != tt.want {
+			t.Errorf("Quantile(%v) = %v, want %v", tt.q, got, tt.want)
+		}
+	}
+
+	if got := NewHistogram(LatencyBounds).Snapshot().Quantile(0.99); got != 0 {
+		t.Errorf("empty Quantile = %v, want 0", got)
+	}
+}
+
+func TestHistogramOverflowBucket(t *testing.T) {
+	h := NewHistogram([]float64{1})
+	h.Observe(7)
+	if got := h.Snapshot().Quantile(0.5); got != 7 {
+		t.Errorf("Quantile(0.5) = %v, want the observed maximum 7", got)
+	}
+}
+
+func TestHistogramConcurrent(t *testing.T) {
+	h := NewHistogram(LatencyBounds)
+	var wg sync.WaitGroup
+	for g := 0; g < 8; g++ {
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+			for i := 0; i < 1000; i++ {
+				h.Observe(float64(i % 50))
+			}
+		}()
+	}
+	wg.Wait()
+	if got := h.Snapshot().Count; got != 8000 {
+		t.Errorf("count = %d, want 8000", got)
+	}
+}
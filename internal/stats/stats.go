@@ -0,0 +1,376 @@
+// Package stats collects per-query transfer and conversion metrics for the
+// duckarrow table function. It has no CGO dependencies so it can be unit tested
+// without a DuckDB runtime.
+package stats
+
+import (
+	"sort"
+	"sync"
+	"time"
+)
+
+// DefaultCapacity is the number of finished queries kept by the default registry.
+const DefaultCapacity = 128
+
+// Query holds the metrics recorded for one remote scan.
+type Query struct {
+	ID         uint64
+	Connection uint64 // DuckDB connection ID that ran the scan; 0 if unknown
+	URI        string
+	SQL        string
+	Columns    []string // Projected columns pushed to the server; nil means all
+	StartedAt  time.Time
+
+	BindLatency  time.Duration // Remote schema discovery during bind
+	QueryLatency time.Duration // ExecuteQuery round trip for the data query
+	FirstBatch   time.Duration // From data query start until the first batch arrived
+	Total        time.Duration // From bind start until the scan finished
+
+	Batches int64 // Record batches received
+	Bytes   int64 // Arrow buffer bytes received
+	Rows    int64 // Rows emitted to DuckDB
+
+	MinBatchRows int64 // Rows in the smallest batch received
+	MaxBatchRows int64 // Rows in the largest batch received
+
+	NextTime      time.Duration            // Time blocked in Reader.Next
+	ConvertTime   time.Duration            // Time spent converting Arrow to DuckDB
+	ConvertByType map[string]time.Duration // ConvertTime split by Arrow type name
+
+	Error string
+}
+
+// Totals holds cumulative counters across all finished queries.
+type Totals struct {
+	Queries int64
+	Errors  int64
+	Batches int64
+	Bytes   int64
+	Rows    int64
+
+	BindTime      time.Duration
+	QueryTime     time.Duration
+	NextTime      time.Duration
+	ConvertTime   time.Duration
+	ConvertByType map[string]time.Duration
+
+	// Sizes of every batch received, including by scans still running
+	BatchRows  HistogramSnapshot
+	BatchBytes HistogramSnapshot
+}
+
+// BatchRowBounds are bucket bounds for batch row counts, from 256 to 4M.
+var BatchRowBounds = ExponentialBounds(256, 2, 15)
+
+// BatchByteBounds are bucket bounds for batch sizes in bytes, from 4KiB to 2GiB.
+var BatchByteBounds = ExponentialBounds(4096, 2, 20)
+
+// Registry keeps the most recent finished queries in a ring buffer together
+// with cumulative totals. It is safe for concurrent use.
+type Registry struct {
+	mu     sync.Mutex
+	nextID uint64
+	recent []Query
+	head   int // Index of the next slot to write
+	count  int
+	totals Totals
+
+	batchRows  *Histogram
+	batchBytes *Histogram
+
+	captures []*Capture
+}
+
+// Capture collects every query of one connection that begins after it
+// starts, in addition to the ring buffer. It is used to attribute scans to
+// one statement (duckarrow_explain).
+type Capture struct {
+	firstID    uint64
+	connection uint64
+	queries    []Query
+}
+
+// Default is the registry used by the extension.
+var Default = NewRegistry(DefaultCapacity)
+
+// NewRegistry creates a registry that keeps up to capacity finished queries.
+func NewRegistry(capacity int) *Registry {
+	if capacity < 1 {
+		capacity = 1
+	}
+	return &Registry{
+		recent:     make([]Query, capacity),
+		totals:     Totals{ConvertByType: make(map[string]time.Duration)},
+		batchRows:  NewHistogram(BatchRowBounds),
+		batchBytes: NewHistogram(BatchByteBounds),
+	}
+}
+
+// Begin starts recording a new query. The returned Recorder must be finished
+// with Finish for the query to appear in Recent and Totals.
+func (r *Registry) Begin(uri, sql string) *Recorder {
+	r.mu.Lock()
+	r.nextID++
+	id := r.nextID
+	r.mu.Unlock()
+
+	now := time.Now()
+	return &Recorder{
+		registry: r,
+		start:    now,
+		q: Query{
+			ID:        id,
+			URI:       uri,
+			SQL:       sql,
+			StartedAt: now,
+		},
+	}
+}
+
+// Recent returns the finished queries in the ring buffer, newest first.
+func (r *Registry) Recent() []Query {
+	r.mu.Lock()
+	defer r.mu.Unlock()
+
+	out := make([]Query, 0, r.count)
+	for i := 1; i <= r.count; i++ {
+		idx := (r.head - i + len(r.recent)) % len(r.recent)
+		out = append(out, r.recent[idx])
+	}
+	return out
+}
+
+// Totals returns a copy of the cumulative counters.
+func (r *Registry) Totals() Totals {
+	r.mu.Lock()
+	defer r.mu.Unlock()
+
+	t := r.totals
+	t.ConvertByType = make(map[string]time.Duration, len(r.totals.ConvertByType))
+	for k, v := range r.totals.ConvertByType {
+		t.ConvertByType[k] = v
+	}
+	t.BatchRows = r.batchRows.Snapshot()
+	t.BatchBytes = r.batchBytes.Snapshot()
+	return t
+}
+
+// StartCapture begins collecting the queries of the DuckDB connection with
+// the given ID. Queries of other connections are not collected.
+func (r *Registry) StartCapture(connection uint64) *Capture {
+	r.mu.Lock()
+	defer r.mu.Unlock()
+	c := &Capture{firstID: r.nextID + 1, connection: connection}
+	r.captures = append(r.captures, c)
+	return c
+}
+
+// StopCapture stops c and returns the queries it collected that have
+// finished, ordered by ID.
+func (r *Registry) StopCapture(c *Capture) []Query {
+	r.mu.Lock()
+	defer r.mu.Unlock()
+	for i, active := range r.captures {
+		if active == c {
+			r.captures = append(r.captures[:i], r.captures[i+1:]...)
+			break
+		}
+	}
+	sort.Slice(c.queries, func(i, j int) bool { return c.queries[i].ID < c.queries[j].ID })
+	return c.queries
+}
+
+// Reset clears the ring buffer and cumulative counters. Query IDs keep increasing.
+func (r *Registry) Reset() {
+	r.mu.Lock()
+	defer r.mu.Unlock()
+
+	for i := range r.recent {
+		r.recent[i] = Query{}
+	}
+	r.head = 0
+	r.count = 0
+	r.totals = Totals{ConvertByType: make(map[string]time.Duration)}
+	r.batchRows.Reset()
+	r.batchBytes.Reset()
+}
+
+func (r *Registry) publish(q Query) {
+	r.mu.Lock()
+	defer r.mu.Unlock()
+
+	for _, c := range r.captures {
+		if q.ID >= c.firstID && q.Connection == c.connection {
+			c.queries = append(c.queries, q)
+		}
+	}
+
+	r.recent[r.head] = q
+	r.head = (r.head + 1) % len(r.recent)
+	if r.count < len(r.recent) {
+		r.count++
+	}
+
+	t := &r.totals
+	t.Queries++
+	if q.Error != "" {
+		t.Errors++
+	}
+	t.Batches += q.Batches
+	t.Bytes += q.Bytes
+	t.Rows += q.Rows
+	t.BindTime += q.BindLatency
+	t.QueryTime += q.QueryLatency
+	t.NextTime += q.NextTime
+	t.ConvertTime += q.ConvertTime
+	for k, v := range q.ConvertByType {
+		t.ConvertByType[k] += v
+	}
+}
+
+// Recorder accumulates metrics for a single scan.
+//
+// A duckarrow scan is driven by one DuckDB thread at a time, so Recorder is not
+// safe for concurrent use. All methods are no-ops on a nil Recorder, which lets
+// callers skip nil checks for scans that are not instrumented (hardcoded mode).
+type Recorder struct {
+	registry  *Registry
+	q         Query
+	start     time.Time
+	execStart time.Time
+	colTypes  []string        // Arrow type name per output column
+	colTimes  []time.Duration // Conversion time per output column
+	finished  bool
+}
+
+// SetConnection records the ID of the DuckDB connection running the scan.
+func (rec *Recorder) SetConnection(id uint64) {
+	if rec == nil {
+		return
+	}
+	rec.q.Connection = id
+}
+
+// SetSQL records the SQL text actually sent to the server.
+func (rec *Recorder) SetSQL(sql string) {
+	if rec == nil {
+		return
+	}
+	rec.q.SQL = sql
+}
+
+// ObserveBind records the latency of remote schema discovery.
+func (rec *Recorder) ObserveBind(d time.Duration) {
+	if rec == nil {
+		return
+	}
+	rec.q.BindLatency += d
+}
+
+// ObserveExecute records the latency of the data query that started at start.
+// Time to first batch is measured from the same start time.
+func (rec *Recorder) ObserveExecute(start time.Time) {
+	if rec == nil {
+		return
+	}
+	rec.execStart = start
+	rec.q.QueryLatency = time.Since(start)
+}
+
+// SetColumns records the projected column names pushed to the server.
+func (rec *Recorder) SetColumns(columns []string) {
+	if rec == nil {
+		return
+	}
+	rec.q.Columns = columns
+}
+
+// SetColumnTypes sets the Arrow type name of each output column, used to split
+// conversion time by type.
+func (rec *Recorder) SetColumnTypes(types []string) {
+	if rec == nil {
+		return
+	}
+	rec.colTypes = types
+	rec.colTimes = make([]time.Duration, len(types))
+}
+
+// ObserveNext records one Reader.Next call that took d. When ok is true a batch
+// of the given rows and size in bytes was received.
+func (rec *Recorder) ObserveNext(d time.Duration, ok bool, rows, bytes int64) {
+	if rec == nil {
+		return
+	}
+	rec.q.NextTime += d
+	if !ok {
+		return
+	}
+	if rec.q.Batches == 0 && !rec.execStart.IsZero() {
+		rec.q.FirstBatch = time.Since(rec.execStart)
+	}
+	if rec.q.Batches == 0 || rows < rec.q.MinBatchRows {
+		rec.q.MinBatchRows = rows
+	}
+	rec.q.MaxBatchRows = max(rec.q.MaxBatchRows, rows)
+	rec.q.Batches++
+	rec.q.Bytes += bytes
+	rec.registry.batchRows.Observe(float64(rows))
+	rec.registry.batchBytes.Observe(float64(bytes))
+}
+
+// ObserveConvert records conversion time for the output column at index col.
+func (rec *Recorder) ObserveConvert(col int, d time.Duration) {
+	if rec == nil {
+		return
+	}
+	rec.q.ConvertTime += d
+	if col >= 0 && col < len(rec.colTimes) {
+		rec.colTimes[col] += d
+	}
+}
+
+// ObserveRows records rows emitted to DuckDB.
+func (rec *Recorder) ObserveRows(n int) {
+	if rec == nil {
+		return
+	}
+	rec.q.Rows += int64(n)
+}
+
+// Fail records the error that terminated the query. Only the first error is kept.
+func (rec *Recorder) Fail(err error) {
+	if rec == nil || err == nil || rec.q.Error != "" {
+		return
+	}
+	rec.q.Error = err.Error()
+}
+
+// Finish publishes the query to its registry and returns it. Calls after the
+// first are no-ops returning false, so it is safe to call both when the stream
+// is exhausted and on cleanup.
+func (rec *Recorder) Finish() (Query, bool) {
+	if rec == nil || rec.finished {
+		return Query{}, false
+	}
+	rec.finished = true
+	rec.q.Total = time.Since(rec.start)
+
+	if len(rec.colTypes) > 0 {
+		rec.q.ConvertByType = make(map[string]time.Duration, len(rec.colTypes))
+		for i, name := range rec.colTypes {
+			rec.q.ConvertByType[name] += rec.colTimes[i]
+		}
+	}
+	rec.registry.publish(rec.q)
+	return rec.q, true
+}
+
+// SortedTypes returns the keys of a per-type duration map in a stable order.
+func SortedTypes(m map[string]time.Duration) []string {
+	keys := make([]string, 0, len(m))
+	for k := range m {
+		keys = append(keys, k)
+	}
+	sort.Strings(keys)
+	return keys
+}
@@ -0,0 +1,213 @@
+package stats
+
+import (
+	"errors"
+	"sync"
+	"testing"
+	"time"
+)
+
+func TestRecorderPublishesOnFinish(t *testing.T) {
+	reg := NewRegistry(4)
+
+	rec := reg.Begin("grpc://localhost:31337", `SELECT * FROM "Order"`)
+	rec.SetSQL(`SELECT "id" FROM "Order"`)
+	rec.ObserveBind(2 * time.Millisecond)
+	rec.ObserveExecute(time.Now())
+	rec.SetColumnTypes([]string{"int64", "utf8", "int64"})
+	rec.ObserveNext(time.Millisecond, true, 2048, 1024)
+	rec.ObserveNext(time.Millisecond, true, 100, 512)
+	rec.ObserveNext(time.Millisecond, false, 0, 0)
+	rec.ObserveConvert(0, 3*time.Millisecond)
+	rec.ObserveConvert(1, 5*time.Millisecond)
+	rec.ObserveConvert(2, 4*time.Millisecond)
+	rec.ObserveRows(2048)
+	rec.ObserveRows(100)
+
+	if got := len(reg.Recent()); got != 0 {
+		t.Fatalf("expected no published queries before Finish, got %d", got)
+	}
+
+	if _, ok := rec.Finish(); !ok {
+		t.Error("first Finish should report the published query")
+	}
+	if _, ok := rec.Finish(); ok { // Second Finish must not publish twice
+		t.Error("second Finish should be a no-op")
+	}
+
+	recent := reg.Recent()
+	if len(recent) != 1 {
+		t.Fatalf("expected 1 published query, got %d", len(recent))
+	}
+	q := recent[0]
+	if q.SQL != `SELECT "id" FROM "Order"` {
+		t.Errorf("SQL = %q, want projected query", q.SQL)
+	}
+	if q.Batches != 2 || q.Bytes != 1536 || q.Rows != 2148 {
+		t.Errorf("batches/bytes/rows = %d/%d/%d, want 2/1536/2148", q.Batches, q.Bytes, q.Rows)
+	}
+	if q.MinBatchRows != 100 || q.MaxBatchRows != 2048 {
+		t.Errorf("batch rows min/max = %d/%d, want 100/2048", q.MinBatchRows, q.MaxBatchRows)
+	}
+	if q.NextTime != 3*time.Millisecond {
+		t.Errorf("NextTime = %v, want 3ms", q.NextTime)
+	}
+	if q.ConvertTime != 12*time.Millisecond {
+		t.Errorf("ConvertTime = %v, want 12ms", q.ConvertTime)
+	}
+	if q.ConvertByType["int64"] != 7*time.Millisecond || q.ConvertByType["utf8"] != 5*time.Millisecond {
+		t.Errorf("ConvertByType = %v, want int64=7ms utf8=5ms", q.ConvertByType)
+	}
+	if q.FirstBatch <= 0 {
+		t.Error("FirstBatch should be set after the first batch")
+	}
+
+	totals := reg.Totals()
+	if totals.Queries != 1 || totals.Rows != 2148 || totals.Errors != 0 {
+		t.Errorf("totals = %+v, want 1 query, 2148 rows, 0 errors", totals)
+	}
+	if totals.BatchRows.Count != 2 || totals.BatchRows.Min != 100 || totals.BatchRows.Max != 2048 {
+		t.Errorf("batch rows histogram = %+v, want 2 batches of 100 and 2048 rows", totals.BatchRows)
+	}
+	if totals.BatchBytes.Sum != 1536 {
+		t.Errorf("batch bytes sum = %v, want 1536", totals.BatchBytes.Sum)
+	}
+}
+
+func TestRecorderFailKeepsFirstError(t *testing.T) {
+	reg := NewRegistry(4)
+	rec := reg.Begin("grpc://localhost:31337", "SELECT 1")
+	rec.Fail(errors.New("first"))
+	rec.Fail(errors.New("second"))
+	rec.Finish()
+
+	q := reg.Recent()[0]
+	if q.Error != "first" {
+		t.Errorf("Error = %q, want %q", q.Error, "first")
+	}
+	if reg.Totals().Errors != 1 {
+		t.Errorf("Errors = %d, want 1", reg.Totals().Errors)
+	}
+}
+
+func TestRegistryRingBufferNewestFirst(t *testing.T) {
+	reg := NewRegistry(3)
+	for i := 0; i < 5; i++ {
+		reg.Begin("grpc://localhost:31337", "SELECT 1").Finish()
+	}
+
+	recent := reg.Recent()
+	if len(recent) != 3 {
+		t.Fatalf("expected ring buffer to hold 3 queries, got %d", len(recent))
+	}
+	wantIDs := []uint64{5, 4, 3}
+	for i, q := range recent {
+		if q.ID != wantIDs[i] {
+			t.Errorf("recent[%d].ID = %d, want %d", i, q.ID, wantIDs[i])
+		}
+	}
+	if reg.Totals().Queries != 5 {
+		t.Errorf("Totals().Queries = %d, want 5 (totals are cumulative)", reg.Totals().Queries)
+	}
+}
+
+func TestRegistryReset(t *testing.T) {
+	reg := NewRegistry(3)
+	rec0 := reg.Begin("grpc://localhost:31337", "SELECT 1")
+	rec0.ObserveNext(time.Millisecond, true, 2048, 4096)
+	rec0.Finish()
+	reg.Reset()
+
+	if len(reg.Recent()) != 0 {
+		t.Error("Recent() should be empty after Reset")
+	}
+	if totals := reg.Totals(); totals.Queries != 0 || totals.BatchRows.Count != 0 {
+		t.Error("Totals() should be zero after Reset")
+	}
+
+	// IDs keep increasing so rows from before and after a reset are distinguishable
+	rec := reg.Begin("grpc://localhost:31337", "SELECT 1")
+	rec.Finish()
+	if reg.Recent()[0].ID != 2 {
+		t.Errorf("ID after reset = %d, want 2", reg.Recent()[0].ID)
+	}
+}
+
+func TestNilRecorderIsNoop(t *testing.T) {
+	var rec *Recorder
+	rec.SetConnection(1)
+	rec.SetSQL("SELECT 1")
+	rec.ObserveBind(time.Millisecond)
+	rec.ObserveExecute(time.Now())
+	rec.SetColumnTypes([]string{"int64"})
+	rec.ObserveNext(time.Millisecond, true, 1, 10)
+	rec.ObserveConvert(0, time.Millisecond)
+	rec.ObserveRows(1)
+	rec.Fail(errors.New("ignored"))
+	rec.Finish()
+}
+
+func TestRegistryConcurrentFinish(t *testing.T) {
+	reg := NewRegistry(16)
+
+	const numGoroutines = 50
+	var wg sync.WaitGroup
+	wg.Add(numGoroutines)
+	for i := 0; i < numGoroutines; i++ {
+		go func() {
+			defer wg.Done()
+			rec := reg.Begin("grpc://localhost:31337", "SELECT 1")
+			rec.ObserveRows(10)
+			rec.Finish()
+			_ = reg.Recent()
+			_ = reg.Totals()
+		}()
+	}
+	wg.Wait()
+
+	if got := reg.Totals().Rows; got != numGoroutines*10 {
+		t.Errorf("Totals().Rows = %d, want %d", got, numGoroutines*10)
+	}
+}
+
+func TestCapture(t *testing.T) {
+	reg := NewRegistry(2)
+
+	begin := func(sql string, connection uint64) *Recorder {
+		rec := reg.Begin("grpc://a", sql)
+		rec.SetConnection(connection)
+		return rec
+	}
+	before := begin("before", 7)
+	c := reg.StartCapture(7)
+	first := begin("first", 7)
+	other := begin("other connection", 8)
+	second := begin("second", 7)
+	second.SetColumns([]string{"id", "name"})
+	third := begin("third", 7)
+	unfinished := begin("unfinished", 7)
+
+	// Finish out of order; the ring buffer only holds 2 but the capture keeps all
+	third.Finish()
+	before.Finish()
+	first.Finish()
+	other.Finish() // Another connection: not collected
+	second.Finish()
+
+	got := reg.StopCapture(c)
+	unfinished.Finish() // After StopCapture: not collected
+
+	var sqls []string
+	for _, q := range got {
+		sqls = append(sqls, q.SQL)
+	}
+	if len(sqls) != 3 || sqls[0] != "first" || sqls[1] != "second" || sqls[2] != "third" {
+		t.Fatalf("captured %v, want [first second third]", sqls)
+	}
+	if cols := got[1].Columns; len(cols) != 2 || cols[0] != "id" {
+		t.Errorf("Columns = %v, want [id name]", cols)
+	}
+	if len(reg.captures) != 0 {
+		t.Errorf("StopCapture should deregister the capture")
+	}
+}
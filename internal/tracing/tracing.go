@@ -0,0 +1,269 @@
+// Package tracing records timelines of remote scans as Chrome trace events
+// (the JSON format read by chrome://tracing, Perfetto and speedscope). Events
+// go to a local file, so no collector is required.
+//
+// Each sampled scan is one Trace and is drawn on its own track, so the scans
+// of a multi-scan query appear side by side. All methods are no-ops on a nil
+// *Trace or *Span, which is what Begin returns when tracing is disabled or the
+// scan was not sampled.
+package tracing
+
+import (
+	"bufio"
+	"context"
+	"encoding/json"
+	"errors"
+	"fmt"
+	"math/rand"
+	"os"
+	"sync"
+	"time"
+)
+
+// Tracer writes trace events to a file. It is safe for concurrent use.
+type Tracer struct {
+	mu     sync.Mutex
+	path   string
+	file   *os.File
+	w      *bufio.Writer
+	events int // Events written to the current file
+	rate   float64
+	rng    *rand.Rand
+	nextID uint64
+	pid    int
+}
+
+// Default is the tracer used by the extension. It is disabled until Open is called.
+var Default = New()
+
+// New creates a disabled tracer that samples every trace once opened.
+func New() *Tracer {
+	return &Tracer{rate: 1, rng: rand.New(rand.NewSource(time.Now().UnixNano())), pid: os.Getpid()}
+}
+
+// Open starts writing events to a new file at path, replacing any file
+// already open. An existing file is never overwritten: Open fails, and the
+// current file stays open. An empty path disables tracing.
+func (t *Tracer) Open(path string) error {
+	t.mu.Lock()
+	defer t.mu.Unlock()
+
+	if path == "" {
+		return t.closeLocked()
+	}
+	f, err := os.OpenFile(path, os.O_WRONLY|os.O_CREATE|os.O_EXCL, 0o644)
+	if err != nil {
+		return err
+	}
+	if err := t.closeLocked(); err != nil {
+		f.Close()
+		return err
+	}
+	t.path, t.file, t.w, t.events = path, f, bufio.NewWriter(f), 0
+	// The JSON array form lets viewers load the file even if Close never runs
+	if _, err := t.w.WriteString("[\n"); err != nil {
+		t.closeLocked()
+		return err
+	}
+	return nil
+}
+
+// Close terminates the JSON array and closes the trace file.
+func (t *Tracer) Close() error {
+	t.mu.Lock()
+	defer t.mu.Unlock()
+	return t.closeLocked()
+}
+
+func (t *Tracer) closeLocked() error {
+	if t.file == nil {
+		return nil
+	}
+	_, werr := t.w.WriteString("\n]\n")
+	ferr := t.w.Flush()
+	cerr := t.file.Close()
+	t.path, t.file, t.w = "", nil, nil
+	return errors.Join(werr, ferr, cerr)
+}
+
+// Path returns the current trace file, or "" if tracing is disabled.
+func (t *Tracer) Path() string {
+	t.mu.Lock()
+	defer t.mu.Unlock()
+	return t.path
+}
+
+// SetSampleRate sets the fraction of traces recorded, between 0 and 1.
+func (t *Tracer) SetSampleRate(rate float64) error {
+	if rate < 0 || rate > 1 {
+		return fmt.Errorf("sample rate must be between 0 and 1, got %v", rate)
+	}
+	t.mu.Lock()
+	defer t.mu.Unlock()
+	t.rate = rate
+	return nil
+}
+
+// SampleRate returns the fraction of traces recorded.
+func (t *Tracer) SampleRate() float64 {
+	t.mu.Lock()
+	defer t.mu.Unlock()
+	return t.rate
+}
+
+// Begin starts a trace and its root span. It returns nil if tracing is
+// disabled or the trace was not sampled. label names the trace's track in
+// the viewer.
+func (t *Tracer) Begin(name, label string) *Trace {
+	t.mu.Lock()
+	if t.file == nil || (t.rate < 1 && t.rng.Float64() >= t.rate) {
+		t.mu.Unlock()
+		return nil
+	}
+	t.nextID++
+	tr := &Trace{tracer: t, id: t.nextID}
+	t.mu.Unlock()
+
+	tr.tracer.write(event{
+		Name: "thread_name", Phase: "M", PID: t.pid, TID: tr.id,
+		Args: map[string]any{"name": fmt.Sprintf("%d %s", tr.id, label)},
+	})
+	tr.root = tr.Span(name)
+	return tr
+}
+
+// event is one Chrome trace event.
+type event struct {
+	Name     string         `json:"name"`
+	Category string         `json:"cat,omitempty"`
+	Phase    string         `json:"ph"`
+	TS       float64        `json:"ts"`            // Microseconds
+	Dur      float64        `json:"dur,omitempty"` // Microseconds, complete events only
+	PID      int            `json:"pid"`
+	TID      uint64         `json:"tid"`
+	Args     map[string]any `json:"args,omitempty"`
+}
+
+func (t *Tracer) write(e event) {
+	data, err := json.Marshal(e)
+	if err != nil {
+		return
+	}
+	t.mu.Lock()
+	defer t.mu.Unlock()
+	if t.w == nil {
+		return // Closed while the trace was running
+	}
+	if t.events > 0 {
+		t.w.WriteString(",\n")
+	}
+	t.w.Write(data)
+	t.events++
+}
+
+func (t *Tracer) flush() {
+	t.mu.Lock()
+	defer t.mu.Unlock()
+	if t.w != nil {
+		t.w.Flush()
+	}
+}
+
+// Trace is the timeline of one remote scan.
+type Trace struct {
+	tracer *Tracer
+	id     uint64
+	root   *Span
+}
+
+// Span starts a span on the trace's track.
+func (tr *Trace) Span(name string) *Span {
+	if tr == nil {
+		return nil
+	}
+	return &Span{trace: tr, name: name, start: time.Now()}
+}
+
+// Arg attaches an argument to the root span.
+func (tr *Trace) Arg(key string, value any) {
+	if tr == nil {
+		return
+	}
+	tr.root.Arg(key, value)
+}
+
+// End ends the root span and flushes the trace to disk. Spans ended later
+// are still written.
+func (tr *Trace) End() {
+	if tr == nil {
+		return
+	}
+	tr.root.End()
+	tr.tracer.flush()
+}
+
+// Span is a timed operation within a trace.
+type Span struct {
+	trace *Trace
+	name  string
+	start time.Time
+	args  map[string]any
+	ended bool
+}
+
+// Arg attaches an argument shown in the viewer's details pane. Returns the
+// span for chaining.
+func (s *Span) Arg(key string, value any) *Span {
+	if s == nil {
+		return nil
+	}
+	if s.args == nil {
+		s.args = make(map[string]any)
+	}
+	s.args[key] = value
+	return s
+}
+
+// Fail records err on the span.
+func (s *Span) Fail(err error) {
+	if s == nil || err == nil {
+		return
+	}
+	s.Arg("error", err.Error())
+}
+
+// End writes the span as a complete event. Only the first call has an effect.
+func (s *Span) End() {
+	if s == nil || s.ended {
+		return
+	}
+	s.ended = true
+	t := s.trace.tracer
+	t.write(event{
+		Name:     s.name,
+		Category: "duckarrow",
+		Phase:    "X",
+		TS:       float64(s.start.UnixNano()) / 1e3,
+		Dur:      float64(time.Since(s.start).Nanoseconds()) / 1e3,
+		PID:      t.pid,
+		TID:      s.trace.id,
+		Args:     s.args,
+	})
+}
+
+type contextKey struct{}
+
+// NewContext returns a context carrying tr, so code below the table function
+// (connection pool, Flight client) can add spans to the scan's trace.
+func NewContext(ctx context.Context, tr *Trace) context.Context {
+	if tr == nil {
+		return ctx
+	}
+	return context.WithValue(ctx, contextKey{}, tr)
+}
+
+// FromContext returns the trace carried by ctx, or nil.
+func FromContext(ctx context.Context) *Trace {
+	tr, _ := ctx.Value(contextKey{}).(*Trace)
+	return tr
+}
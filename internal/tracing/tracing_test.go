@@ -0,0 +1,185 @@
+package tracing
+
+import (
+	"context"
+	"encoding/json"
+	"errors"
+	"os"
+	"path/filepath"
+	"sync"
+	"testing"
+)
+
+// readEvents parses a closed trace file.
+func readEvents(t *testing.T, path string) []event {
+	t.Helper()
+	data, err := os.ReadFile(path)
+	if err != nil {
+		t.Fatal(err)
+	}
+	var events []event
+	if err := json.Unmarshal(data, &events); err != nil {
+		t.Fatalf("trace file is not a JSON array: %v\n%s", err, data)
+	}
+	return events
+}
+
+func TestTraceEvents(t *testing.T) {
+	path := filepath.Join(t.TempDir(), "trace.json")
+	tracer := New()
+	if err := tracer.Open(path); err != nil {
+		t.Fatal(err)
+	}
+
+	tr := tracer.Begin("scan", "Orders")
+	tr.Arg("uri", "grpc://localhost:31337")
+	tr.Span("fetch").Arg("rows", 2048).End()
+	span := tr.Span("convert")
+	span.Fail(errors.New("boom"))
+	span.End()
+	span.End() // Second End must not write a duplicate event
+	tr.End()
+
+	if err := tracer.Close(); err != nil {
+		t.Fatal(err)
+	}
+
+	events := readEvents(t, path)
+	var names []string
+	for _, e := range events {
+		names = append(names, e.Name)
+		if e.TID != 1 {
+			t.Errorf("event %s on track %d, want 1", e.Name, e.TID)
+		}
+	}
+	want := []string{"thread_name", "fetch", "convert", "scan"}
+	if len(names) != len(want) {
+		t.Fatalf("events = %v, want %v", names, want)
+	}
+	for i := range want {
+		if names[i] != want[i] {
+			t.Fatalf("events = %v, want %v", names, want)
+		}
+	}
+
+	if events[0].Phase != "M" || events[0].Args["name"] != "1 Orders" {
+		t.Errorf("metadata event = %+v", events[0])
+	}
+	if events[1].Args["rows"] != float64(2048) {
+		t.Errorf("fetch args = %v", events[1].Args)
+	}
+	if events[2].Args["error"] != "boom" {
+		t.Errorf("convert args = %v", events[2].Args)
+	}
+	root := events[3]
+	if root.Phase != "X" || root.Args["uri"] != "grpc://localhost:31337" {
+		t.Errorf("root span = %+v", root)
+	}
+	if root.TS > events[1].TS || root.TS+root.Dur < events[2].TS {
+		t.Error("root span should enclose its child spans")
+	}
+}
+
+func TestDisabledAndUnsampled(t *testing.T) {
+	tracer := New()
+	if tr := tracer.Begin("scan", "t"); tr != nil {
+		t.Error("Begin on a tracer without a file should return nil")
+	}
+
+	path := filepath.Join(t.TempDir(), "trace.json")
+	if err := tracer.Open(path); err != nil {
+		t.Fatal(err)
+	}
+	defer tracer.Close()
+	if err := tracer.SetSampleRate(0); err != nil {
+		t.Fatal(err)
+	}
+	if tr := tracer.Begin("scan", "t"); tr != nil {
+		t.Error("Begin with sample rate 0 should return nil")
+	}
+
+	// A nil trace and its spans are safe to use
+	var tr *Trace
+	tr.Arg("k", "v")
+	tr.Span("fetch").Arg("rows", 1).End()
+	tr.End()
+	if FromContext(NewContext(context.Background(), tr)) != nil {
+		t.Error("nil trace should not be stored in a context")
+	}
+}
+
+func TestSetSampleRateBounds(t *testing.T) {
+	tracer := New()
+	for _, rate := range []float64{-0.1, 1.5} {
+		if err := tracer.SetSampleRate(rate); err == nil {
+			t.Errorf("SetSampleRate(%v) should fail", rate)
+		}
+	}
+	if err := tracer.SetSampleRate(0.25); err != nil || tracer.SampleRate() != 0.25 {
+		t.Errorf("SetSampleRate(0.25) = %v, rate %v", err, tracer.SampleRate())
+	}
+}
+
+func TestContext(t *testing.T) {
+	tracer := New()
+	if err := tracer.Open(filepath.Join(t.TempDir(), "trace.json")); err != nil {
+		t.Fatal(err)
+	}
+	defer tracer.Close()
+
+	tr := tracer.Begin("scan", "t")
+	if got := FromContext(NewContext(context.Background(), tr)); got != tr {
+		t.Errorf("FromContext = %p, want %p", got, tr)
+	}
+	if FromContext(context.Background()) != nil {
+		t.Error("FromContext on an empty context should return nil")
+	}
+}
+
+func TestReopenAndConcurrentTraces(t *testing.T) {
+	dir := t.TempDir()
+	first, second := filepath.Join(dir, "a.json"), filepath.Join(dir, "b.json")
+	tracer := New()
+	if err := tracer.Open(first); err != nil {
+		t.Fatal(err)
+	}
+
+	var wg sync.WaitGroup
+	for i := 0; i < 8; i++ {
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+			tr := tracer.Begin("scan", "t")
+			for j := 0; j < 50; j++ {
+				tr.Span("fetch").End()
+			}
+			tr.End()
+		}()
+	}
+	wg.Wait()
+
+	// An existing file is not overwritten, and the first file stays open
+	if err := tracer.Open(first); err == nil {
+		t.Error("Open should not overwrite an existing file")
+	}
+	if tracer.Path() != first {
+		t.Errorf("Path() = %q after a failed Open, want %q", tracer.Path(), first)
+	}
+
+	// Reopening closes the first file, which must be complete
+	if err := tracer.Open(second); err != nil {
+		t.Fatal(err)
+	}
+	if got := len(readEvents(t, first)); got != 8*52 {
+		t.Errorf("first file has %d events, want %d", got, 8*52)
+	}
+	if tracer.Path() != second {
+		t.Errorf("Path() = %q, want %q", tracer.Path(), second)
+	}
+	if err := tracer.Open(""); err != nil || tracer.Path() != "" {
+		t.Errorf("Open(\"\") should disable tracing: err %v, path %q", err, tracer.Path())
+	}
+	if got := len(readEvents(t, second)); got != 0 {
+		t.Errorf("second file has %d events, want 0", got)
+	}
+}
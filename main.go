@@ -14,6 +14,8 @@
 //   - duckarrow_scan_wrapper: Table function scan phase (returns data)
 //   - duckarrow_configure_callback: Scalar function for configuration
 //   - duckarrow_version_callback: Scalar function returning extension version
+//   - duckarrow_rows_bind/init/scan: Introspection table functions (duckarrow_stats)
+//   - duckarrow_command_callback: Operational scalar functions (duckarrow_set, duckarrow_profile_*)
 //   - duckarrow_replacement_scan_callback: Rewrites duckarrow.* table references
 package main
 
@@ -31,6 +33,33 @@ import (
 	"unsafe"
 )
 
+// extensionDB is the database the extension was loaded into. Functions that
+// run SQL on a side connection (duckarrow_explain) connect through it.
+var extensionDB duckdb.Database
+
+// requireExternalAccess fails if DuckDB's enable_external_access setting is
+// off. Functions writing to a file path given in SQL call it first, so they
+// are disabled along with DuckDB's own file access.
+func requireExternalAccess() error {
+	var conn duckdb.Connection
+	if state := duckdb.Connect(extensionDB, &conn); state == duckdb.STATE_ERROR {
+		return fmt.Errorf("failed to open connection")
+	}
+	defer duckdb.Disconnect(&conn)
+
+	query := C.CString("SELECT current_setting('enable_external_access')::BOOLEAN")
+	defer C.free(unsafe.Pointer(query))
+	var result C.duckdb_result
+	defer C.duckdb_destroy_result(&result)
+	if state := C.duckdb_query(C.duckdb_connection(conn.Ptr), query, &result); state == C.DuckDBError {
+		return fmt.Errorf("failed to read enable_external_access: %s", C.GoString(C.duckdb_result_error(&result)))
+	}
+	if !bool(C.duckdb_value_boolean(&result, 0, 0)) {
+		return fmt.Errorf("file access is disabled by enable_external_access")
+	}
+	return nil
+}
+
 //export duckarrow_init_c_api
 func duckarrow_init_c_api(info unsafe.Pointer, access unsafe.Pointer) bool {
 	api, err := duckdb.Init("v1.2.0", info, access)
@@ -40,6 +69,7 @@ func duckarrow_init_c_api(info unsafe.Pointer, access unsafe.Pointer) bool {
 
 	// Get database and open connection for registration
 	db := api.Database()
+	extensionDB = db
 	var conn duckdb.Connection
 	if state := duckdb.Connect(db, &conn); state == duckdb.STATE_ERROR {
 		return false
@@ -88,6 +118,48 @@ func duckarrow_init_c_api(info unsafe.Pointer, access unsafe.Pointer) bool {
 		return false
 	}
 
+	// Register duckarrow_stats and duckarrow_stats_totals table functions
+	if state := RegisterDuckArrowStatsFunctions(conn); state == duckdb.STATE_ERROR {
+		fmt.Println("[duckarrow] Failed to register duckarrow_stats functions")
+		return false
+	}
+
+	// Register duckarrow_pool_stats table function
+	if state := RegisterDuckArrowPoolStatsFunction(conn); state == duckdb.STATE_ERROR {
+		fmt.Println("[duckarrow] Failed to register duckarrow_pool_stats function")
+		return false
+	}
+
+	// Register duckarrow_set scalar function and duckarrow_settings table function
+	if state := RegisterDuckArrowSettingsFunctions(conn); state == duckdb.STATE_ERROR {
+		fmt.Println("[duckarrow] Failed to register duckarrow_set functions")
+		return false
+	}
+
+	// Register duckarrow_profile_* and duckarrow_pprof_* scalar functions
+	if state := RegisterDuckArrowProfileFunctions(conn); state == duckdb.STATE_ERROR {
+		fmt.Println("[duckarrow] Failed to register duckarrow_profile functions")
+		return false
+	}
+
+	// Register duckarrow_explain table function
+	if state := RegisterDuckArrowExplainFunction(conn); state == duckdb.STATE_ERROR {
+		fmt.Println("[duckarrow] Failed to register duckarrow_explain function")
+		return false
+	}
+
+	// Register duckarrow_aggregate table function
+	if state := RegisterDuckArrowAggregateFunction(conn); state == duckdb.STATE_ERROR {
+		fmt.Println("[duckarrow] Failed to register duckarrow_aggregate function")
+		return false
+	}
+
+	// Register duckarrow_tables and duckarrow_columns table functions
+	if state := RegisterDuckArrowCatalogFunctions(conn); state == duckdb.STATE_ERROR {
+		fmt.Println("[duckarrow] Failed to register duckarrow_tables and duckarrow_columns functions")
+		return false
+	}
+
 	// Register replacement scan for duckarrow.* tables
 	RegisterReplacementScan(db)
 
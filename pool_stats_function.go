@@ -0,0 +1,83 @@
+package main
+
+/*
+#cgo CFLAGS: -I${SRCDIR}/duckdb-go-api -DDUCKDB_API_EXCLUDE_FUNCTIONS=1
+#include <duckdb.h>
+#include <duckdb_go_extension.h>
+*/
+import "C"
+import (
+	"duckdb"
+
+	"main/internal/flight"
+)
+
+// duckarrowPoolStatsFunction returns connection pool metrics, one row per
+// server key (URI and username). Latency columns are in milliseconds;
+// percentiles are bucket upper bounds.
+//
+// Usage in SQL:
+//
+//	SELECT uri, acquisitions, hit_rate, in_use_fallbacks, dial_p99_ms FROM duckarrow_pool_stats();
+var duckarrowPoolStatsFunction = &rowsFunction{
+	Name: "duckarrow_pool_stats",
+	Columns: []rowsColumn{
+		{"uri", C.DUCKDB_TYPE_VARCHAR},
+		{"username", C.DUCKDB_TYPE_VARCHAR},
+		{"open_connections", C.DUCKDB_TYPE_BIGINT},
+		{"pooled", C.DUCKDB_TYPE_BOOLEAN},
+		{"in_use", C.DUCKDB_TYPE_BOOLEAN},
+		{"acquisitions", C.DUCKDB_TYPE_BIGINT},
+		{"hits", C.DUCKDB_TYPE_BIGINT},
+		{"hit_rate", C.DUCKDB_TYPE_DOUBLE},
+		{"in_use_fallbacks", C.DUCKDB_TYPE_BIGINT},
+		{"dials", C.DUCKDB_TYPE_BIGINT},
+		{"dial_failures", C.DUCKDB_TYPE_BIGINT},
+		{"stale_evictions", C.DUCKDB_TYPE_BIGINT},
+		{"unhealthy_evictions", C.DUCKDB_TYPE_BIGINT},
+		{"dial_mean_ms", C.DUCKDB_TYPE_DOUBLE},
+		{"dial_p50_ms", C.DUCKDB_TYPE_DOUBLE},
+		{"dial_p99_ms", C.DUCKDB_TYPE_DOUBLE},
+		{"dial_max_ms", C.DUCKDB_TYPE_DOUBLE},
+		{"wait_mean_ms", C.DUCKDB_TYPE_DOUBLE},
+		{"wait_p99_ms", C.DUCKDB_TYPE_DOUBLE},
+		{"wait_max_ms", C.DUCKDB_TYPE_DOUBLE},
+	},
+	Rows: func(_ []string) ([][]any, error) {
+		all := flight.PoolStatistics()
+		rows := make([][]any, len(all))
+		for i, s := range all {
+			rows[i] = []any{
+				s.URI,
+				s.Username,
+				s.Open,
+				s.Pooled,
+				s.InUse,
+				s.Acquisitions,
+				s.Hits,
+				s.HitRate(),
+				s.InUseFallbacks,
+				s.Dials,
+				s.DialFailures,
+				s.StaleEvictions,
+				s.UnhealthyEvictions,
+				s.DialLatency.Mean(),
+				s.DialLatency.Quantile(0.5),
+				s.DialLatency.Quantile(0.99),
+				s.DialLatency.Max,
+				s.WaitLatency.Mean(),
+				s.WaitLatency.Quantile(0.99),
+				s.WaitLatency.Max,
+			}
+		}
+		return rows, nil
+	},
+}
+
+// RegisterDuckArrowPoolStatsFunction registers duckarrow_pool_stats().
+//
+// Returns:
+//   - duckdb.STATE_OK on success, duckdb.STATE_ERROR on failure
+func RegisterDuckArrowPoolStatsFunction(conn duckdb.Connection) duckdb.State {
+	return registerRowsFunction(conn, duckarrowPoolStatsFunction)
+}
@@ -0,0 +1,94 @@
+package main
+
+import (
+	"duckdb"
+	"fmt"
+
+	"main/internal/profiling"
+)
+
+// duckarrowProfileFunctions capture pprof profiles of the extension from SQL.
+// Profiles cover the whole Go runtime inside the DuckDB process: Flight
+// transfers, Arrow decoding, conversion and GC. Profiles are only written to
+// new files, and not at all when DuckDB's enable_external_access is off.
+//
+// Usage in SQL:
+//
+//	SELECT duckarrow_profile_start('cpu', '/tmp/duckarrow.cpu.pprof');  -- or 'trace'
+//	SELECT count(*) FROM duckarrow."Orders";
+//	SELECT duckarrow_profile_stop();
+//	SELECT duckarrow_profile_heap('/tmp/duckarrow.heap.pprof');
+//	SELECT duckarrow_pprof_listen('127.0.0.1:6060');  -- go tool pprof http://127.0.0.1:6060/debug/pprof/heap
+//	SELECT duckarrow_pprof_close();
+var duckarrowProfileFunctions = []*commandFunction{
+	{
+		Name:   "duckarrow_profile_start",
+		Params: 2,
+		Call: func(args []string) (string, error) {
+			if err := requireExternalAccess(); err != nil {
+				return "", err
+			}
+			if err := profiling.Start(args[0], args[1]); err != nil {
+				return "", err
+			}
+			return fmt.Sprintf("%s profile started, writing %s", args[0], args[1]), nil
+		},
+	},
+	{
+		Name: "duckarrow_profile_stop",
+		Call: func(_ []string) (string, error) {
+			kind, path, err := profiling.Stop()
+			if err != nil {
+				return "", err
+			}
+			return fmt.Sprintf("%s profile written to %s", kind, path), nil
+		},
+	},
+	{
+		Name:   "duckarrow_profile_heap",
+		Params: 1,
+		Call: func(args []string) (string, error) {
+			if err := requireExternalAccess(); err != nil {
+				return "", err
+			}
+			if err := profiling.WriteProfile("heap", args[0]); err != nil {
+				return "", err
+			}
+			return "heap profile written to " + args[0], nil
+		},
+	},
+	{
+		Name:   "duckarrow_pprof_listen",
+		Params: 1,
+		Call: func(args []string) (string, error) {
+			addr, err := profiling.Listen(args[0])
+			if err != nil {
+				return "", err
+			}
+			return fmt.Sprintf("pprof listening on http://%s/debug/pprof/", addr), nil
+		},
+	},
+	{
+		Name: "duckarrow_pprof_close",
+		Call: func(_ []string) (string, error) {
+			if err := profiling.CloseListener(); err != nil {
+				return "", err
+			}
+			return "pprof listener closed", nil
+		},
+	},
+}
+
+// RegisterDuckArrowProfileFunctions registers the duckarrow_profile_* and
+// duckarrow_pprof_* scalar functions.
+//
+// Returns:
+//   - duckdb.STATE_OK on success, duckdb.STATE_ERROR on failure
+func RegisterDuckArrowProfileFunctions(conn duckdb.Connection) duckdb.State {
+	for _, fn := range duckarrowProfileFunctions {
+		if state := registerCommandFunction(conn, fn); state == duckdb.STATE_ERROR {
+			return state
+		}
+	}
+	return duckdb.STATE_OK
+}
@@ -3,53 +3,331 @@ package main
 import (
 	"fmt"
 	"regexp"
+	"slices"
 	"strings"
 )
 
-// extractTableName extracts the table name from a query of the form:
-// SELECT * FROM "tablename" or SELECT * FROM "table""name" (with escaped quotes)
-// Returns the unescaped table name.
-func extractTableName(query string) string {
-	// Match SELECT * FROM "tablename" pattern
-	// The table name may contain escaped double quotes (doubled)
-	re := regexp.MustCompile(`(?i)SELECT\s+\*\s+FROM\s+"([^"]*(?:""[^"]*)*)"`)
-	matches := re.FindStringSubmatch(query)
-	if len(matches) >= 2 {
-		// Unescape doubled quotes
-		return strings.ReplaceAll(matches[1], `""`, `"`)
+// TableRef names a remote table, optionally qualified by a schema and a
+// catalog. Parts are unescaped; SQL() quotes them.
+type TableRef struct {
+	Catalog string // Empty for the server's default catalog
+	Schema  string // Empty for the server's default schema
+	Name    string
+}
+
+// IsZero reports whether r names no table, as for arbitrary SQL queries.
+func (r TableRef) IsZero() bool {
+	return r.Name == ""
+}
+
+// parts returns the non-empty qualifiers followed by the table name.
+func (r TableRef) parts() []string {
+	var parts []string
+	if r.Catalog != "" {
+		parts = append(parts, r.Catalog)
+	}
+	if r.Schema != "" || r.Catalog != "" {
+		parts = append(parts, r.Schema)
+	}
+	return append(parts, r.Name)
+}
+
+// SQL returns r as quoted identifiers, e.g. "sales"."Orders".
+func (r TableRef) SQL() string {
+	parts := r.parts()
+	for i, p := range parts {
+		parts[i] = quoteIdent(p)
+	}
+	return strings.Join(parts, ".")
+}
+
+// String returns r's parts joined by dots, unquoted, for labels and messages.
+func (r TableRef) String() string {
+	return strings.Join(r.parts(), ".")
+}
+
+// quoteIdent quotes an identifier, doubling embedded double quotes.
+func quoteIdent(s string) string {
+	return `"` + strings.ReplaceAll(s, `"`, `""`) + `"`
+}
+
+// tableRefFromParts builds a TableRef from one to three name parts.
+func tableRefFromParts(parts []string) (TableRef, error) {
+	switch len(parts) {
+	case 1:
+		return TableRef{Name: parts[0]}, nil
+	case 2:
+		return TableRef{Schema: parts[0], Name: parts[1]}, nil
+	case 3:
+		return TableRef{Catalog: parts[0], Schema: parts[1], Name: parts[2]}, nil
+	}
+	return TableRef{}, fmt.Errorf("table name has %d parts, expected table, schema.table or catalog.schema.table", len(parts))
+}
+
+// parseTableName splits the name DuckDB passes to the replacement scan, e.g.
+// sales.Orders for duckarrow."sales.Orders", into a TableRef. Dots separate
+// parts except inside double quotes, and exactly one pair of surrounding
+// quotes is stripped from each part, so duckarrow."""a.b""" names the
+// unqualified table a.b.
+func parseTableName(name string) (TableRef, error) {
+	var parts []string
+	start, quoted := 0, false
+	for i := 0; i < len(name); i++ {
+		switch name[i] {
+		case '"':
+			quoted = !quoted
+		case '.':
+			if !quoted {
+				parts = append(parts, name[start:i])
+				start = i + 1
+			}
+		}
+	}
+	parts = append(parts, name[start:])
+
+	for i, p := range parts {
+		// Strip exactly one pair: ""table"" -> "table" (a table name containing quotes)
+		if len(p) >= 2 && p[0] == '"' && p[len(p)-1] == '"' {
+			parts[i] = p[1 : len(p)-1]
+		}
+	}
+	return tableRefFromParts(parts)
+}
+
+// selectAllPattern matches the query the replacement scan generates:
+// SELECT * FROM followed by a table reference and nothing else.
+var selectAllPattern = regexp.MustCompile(`(?is)^\s*SELECT\s+\*\s+FROM\s+(.+?)\s*$`)
+
+// identPattern matches one part of a table reference in SQL text: a quoted
+// identifier with doubled quotes, or a bare identifier.
+var identPattern = regexp.MustCompile(`^(?:"((?:[^"]|"")*)"|([A-Za-z_][A-Za-z0-9_$]*))`)
+
+// extractTableRef extracts the table from a query of the form
+// SELECT * FROM "schema"."table" (qualifiers optional, quotes escaped by
+// doubling). It returns the zero TableRef for any other query, which is
+// then run as given without projection pushdown.
+func extractTableRef(query string) TableRef {
+	matches := selectAllPattern.FindStringSubmatch(query)
+	if matches == nil {
+		return TableRef{}
+	}
+	rest := matches[1]
+	var parts []string
+	for {
+		m := identPattern.FindStringSubmatch(rest)
+		if m == nil {
+			return TableRef{}
+		}
+		if m[0][0] == '"' {
+			parts = append(parts, strings.ReplaceAll(m[1], `""`, `"`))
+		} else {
+			parts = append(parts, m[2])
+		}
+		rest = rest[len(m[0]):]
+		if rest == "" {
+			break
+		}
+		if rest[0] != '.' {
+			return TableRef{}
+		}
+		rest = rest[1:]
+	}
+	ref, err := tableRefFromParts(parts)
+	if err != nil {
+		return TableRef{}
+	}
+	return ref
+}
+
+// selectQueryPattern and orderByPattern decide which arbitrary SQL may be
+// wrapped as a subquery: a single SELECT or WITH query without ORDER BY, as
+// the order of a wrapped query's rows is not guaranteed to be kept.
+var (
+	selectQueryPattern = regexp.MustCompile(`(?is)^\s*(?:SELECT|WITH)\b`)
+	orderByPattern     = regexp.MustCompile(`(?i)\bORDER\s+BY\b`)
+)
+
+// projectableQuery returns query without trailing semicolons, and whether
+// it can be wrapped as a subquery to push a projection down.
+func projectableQuery(query string) (string, bool) {
+	query = strings.TrimRight(strings.TrimSpace(query), "; \t\r\n")
+	if !selectQueryPattern.MatchString(query) || orderByPattern.MatchString(query) || strings.Contains(query, ";") {
+		return query, false
+	}
+	return query, true
+}
+
+// uniqueColumns reports whether no two columns share a name. A subquery
+// whose result has duplicate names cannot be projected by name. Names are
+// compared case-insensitively, as servers such as DuckDB resolve them.
+func uniqueColumns(columns []string) bool {
+	seen := make(map[string]bool, len(columns))
+	for _, col := range columns {
+		key := strings.ToLower(col)
+		if seen[key] {
+			return false
+		}
+		seen[key] = true
+	}
+	return true
+}
+
+// buildSubqueryProjection selects columns from the result of query, whose
+// columns are allColumns, all unique (see uniqueColumns). The query is
+// returned unchanged if every column is selected in order.
+func buildSubqueryProjection(query string, columns, allColumns []string) string {
+	if len(columns) == 0 || slices.Equal(columns, allColumns) {
+		return query
 	}
-	// Fallback: try without quotes (shouldn't happen from replacement scan)
-	re = regexp.MustCompile(`(?i)SELECT\s+\*\s+FROM\s+(\S+)`)
-	matches = re.FindStringSubmatch(query)
-	if len(matches) >= 2 {
-		return matches[1]
+
+	escapedCols := make([]string, len(columns))
+	for i, col := range columns {
+		escapedCols[i] = quoteIdent(col)
 	}
-	return ""
+	// The newline keeps a trailing line comment in query from swallowing the wrapper
+	return fmt.Sprintf("SELECT %s FROM (\n%s\n) AS duckarrow_subquery", strings.Join(escapedCols, ", "), query)
 }
 
 // buildProjectedQuery constructs a SQL query with specific columns.
 // If columns is empty, uses SELECT *.
-// tableName should be unescaped; this function handles escaping.
-func buildProjectedQuery(tableName string, columns []string) string {
-	escapedTable := strings.ReplaceAll(tableName, `"`, `""`)
-
+func buildProjectedQuery(table TableRef, columns []string) string {
 	var columnList string
 	if len(columns) == 0 {
 		columnList = "*"
 	} else {
 		escapedCols := make([]string, len(columns))
 		for i, col := range columns {
-			escapedCols[i] = fmt.Sprintf(`"%s"`, strings.ReplaceAll(col, `"`, `""`))
+			escapedCols[i] = quoteIdent(col)
 		}
 		columnList = strings.Join(escapedCols, ", ")
 	}
 
-	return fmt.Sprintf(`SELECT %s FROM "%s"`, columnList, escapedTable)
+	return fmt.Sprintf(`SELECT %s FROM %s`, columnList, table.SQL())
 }
 
 // buildSchemaQuery constructs a query that returns only the schema (no rows).
 // Uses WHERE 1=0 to avoid fetching any data.
-func buildSchemaQuery(tableName string) string {
-	escapedTable := strings.ReplaceAll(tableName, `"`, `""`)
-	return fmt.Sprintf(`SELECT * FROM "%s" WHERE 1=0`, escapedTable)
+func buildSchemaQuery(table TableRef) string {
+	return fmt.Sprintf(`SELECT * FROM %s WHERE 1=0`, table.SQL())
+}
+
+// aggregate is one aggregate pushed to the server, e.g. SUM("total").
+type aggregate struct {
+	Func   string // COUNT, SUM, MIN, MAX or AVG
+	Column string // Unescaped column name; "" for COUNT(*)
+}
+
+// Name returns the aggregate's result column name. This is duckarrow's
+// naming rule, modeled on how DuckDB prints the expression: the lowercased
+// function applied to the column, quoted unless it is a plain lowercase
+// identifier, e.g. sum(total) or avg("Unit Price"). COUNT(*) is count(*)
+// (DuckDB itself names it count_star()).
+func (a aggregate) Name() string {
+	arg := "*"
+	if a.Column != "" {
+		arg = a.Column
+		if !plainIdentPattern.MatchString(arg) {
+			arg = quoteIdent(arg)
+		}
+	}
+	return strings.ToLower(a.Func) + "(" + arg + ")"
+}
+
+// plainIdentPattern matches identifiers that need no quotes in a name.
+var plainIdentPattern = regexp.MustCompile(`^[a-z_][a-z0-9_]*$`)
+
+// aggregatePattern matches one aggregate: a supported function applied to *
+// (COUNT only), a quoted identifier or a bare identifier.
+var aggregatePattern = regexp.MustCompile(`(?i)^\s*(COUNT|SUM|MIN|MAX|AVG)\s*\(\s*(?:(\*)|"((?:[^"]|"")*)"|([A-Za-z_][A-Za-z0-9_$]*))\s*\)\s*$`)
+
+// splitList splits a comma-separated list, ignoring commas inside double quotes.
+func splitList(list string) []string {
+	var items []string
+	start, quoted := 0, false
+	for i := 0; i < len(list); i++ {
+		switch list[i] {
+		case '"':
+			quoted = !quoted
+		case ',':
+			if !quoted {
+				items = append(items, list[start:i])
+				start = i + 1
+			}
+		}
+	}
+	return append(items, list[start:])
+}
+
+// parseAggregates parses a list such as count(*), sum(total), avg("Unit Price").
+func parseAggregates(list string) ([]aggregate, error) {
+	var aggs []aggregate
+	for _, item := range splitList(list) {
+		m := aggregatePattern.FindStringSubmatch(item)
+		if m == nil {
+			return nil, fmt.Errorf("unsupported aggregate %q (expected COUNT(*) or COUNT, SUM, MIN, MAX or AVG of a column)", strings.TrimSpace(item))
+		}
+		agg := aggregate{Func: strings.ToUpper(m[1])}
+		switch {
+		case m[2] != "":
+			if agg.Func != "COUNT" {
+				return nil, fmt.Errorf("unsupported aggregate %q: only COUNT takes *", strings.TrimSpace(item))
+			}
+		case m[4] != "":
+			agg.Column = m[4]
+		default:
+			agg.Column = strings.ReplaceAll(m[3], `""`, `"`)
+		}
+		aggs = append(aggs, agg)
+	}
+	return aggs, nil
+}
+
+// parseColumnList parses a comma-separated list of column names, each quoted
+// or bare. An empty list yields no columns.
+func parseColumnList(list string) ([]string, error) {
+	if strings.TrimSpace(list) == "" {
+		return nil, nil
+	}
+	var columns []string
+	for _, item := range splitList(list) {
+		item = strings.TrimSpace(item)
+		m := identPattern.FindStringSubmatch(item)
+		if m == nil || len(m[0]) != len(item) {
+			return nil, fmt.Errorf("invalid column name %q", item)
+		}
+		if m[0][0] == '"' {
+			columns = append(columns, strings.ReplaceAll(m[1], `""`, `"`))
+		} else {
+			columns = append(columns, m[2])
+		}
+	}
+	return columns, nil
+}
+
+// buildAggregateQuery constructs a query that groups table by the groupBy
+// columns on the server, returning the group columns followed by one column
+// per aggregate, named by aggregate.Name. filter, if not empty, becomes
+// the WHERE clause.
+func buildAggregateQuery(table TableRef, groupBy []string, aggs []aggregate, filter string) string {
+	quotedGroups := make([]string, len(groupBy))
+	for i, col := range groupBy {
+		quotedGroups[i] = quoteIdent(col)
+	}
+	selectList := append([]string(nil), quotedGroups...)
+	for _, agg := range aggs {
+		arg := "*"
+		if agg.Column != "" {
+			arg = quoteIdent(agg.Column)
+		}
+		selectList = append(selectList, fmt.Sprintf("%s(%s) AS %s", agg.Func, arg, quoteIdent(agg.Name())))
+	}
+
+	query := fmt.Sprintf("SELECT %s FROM %s", strings.Join(selectList, ", "), table.SQL())
+	if filter != "" {
+		query += " WHERE (" + filter + ")"
+	}
+	if len(quotedGroups) > 0 {
+		query += " GROUP BY " + strings.Join(quotedGroups, ", ")
+	}
+	return query
 }
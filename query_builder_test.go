@@ -4,59 +4,89 @@ import (
 	"testing"
 )
 
-func TestExtractTableName(t *testing.T) {
+func TestExtractTableRef(t *testing.T) {
 	tests := []struct {
 		name     string
 		query    string
-		expected string
+		expected TableRef
 	}{
 		{
 			name:     "simple table name",
 			query:    `SELECT * FROM "Order"`,
-			expected: "Order",
+			expected: TableRef{Name: "Order"},
 		},
 		{
 			name:     "table with lowercase",
 			query:    `SELECT * FROM "users"`,
-			expected: "users",
+			expected: TableRef{Name: "users"},
 		},
 		{
 			name:     "table with escaped quotes",
 			query:    `SELECT * FROM "table""name"`,
-			expected: `table"name`,
+			expected: TableRef{Name: `table"name`},
 		},
 		{
 			name:     "table with multiple escaped quotes",
 			query:    `SELECT * FROM "a""b""c"`,
-			expected: `a"b"c`,
+			expected: TableRef{Name: `a"b"c`},
 		},
 		{
 			name:     "case insensitive SELECT",
 			query:    `select * from "MyTable"`,
-			expected: "MyTable",
+			expected: TableRef{Name: "MyTable"},
 		},
 		{
 			name:     "extra whitespace",
 			query:    `SELECT  *  FROM  "TestTable"`,
-			expected: "TestTable",
+			expected: TableRef{Name: "TestTable"},
+		},
+		{
+			name:     "schema-qualified",
+			query:    `SELECT * FROM "sales"."Orders"`,
+			expected: TableRef{Schema: "sales", Name: "Orders"},
+		},
+		{
+			name:     "catalog-qualified",
+			query:    `SELECT * FROM "warehouse"."sales"."Orders"`,
+			expected: TableRef{Catalog: "warehouse", Schema: "sales", Name: "Orders"},
+		},
+		{
+			name:     "quoted dot stays in the name",
+			query:    `SELECT * FROM "a.b"`,
+			expected: TableRef{Name: "a.b"},
+		},
+		{
+			name:     "bare identifiers",
+			query:    `SELECT * FROM sales.orders`,
+			expected: TableRef{Schema: "sales", Name: "orders"},
+		},
+		{
+			name:     "too many parts",
+			query:    `SELECT * FROM "a"."b"."c"."d"`,
+			expected: TableRef{},
+		},
+		{
+			name:     "trailing clause is not a plain table scan",
+			query:    `SELECT * FROM "Order" WHERE id > 1`,
+			expected: TableRef{},
 		},
 		{
 			name:     "empty query",
 			query:    "",
-			expected: "",
+			expected: TableRef{},
 		},
 		{
 			name:     "invalid query format",
 			query:    "INSERT INTO table VALUES (1)",
-			expected: "",
+			expected: TableRef{},
 		},
 	}
 
 	for _, tt := range tests {
 		t.Run(tt.name, func(t *testing.T) {
-			result := extractTableName(tt.query)
+			result := extractTableRef(tt.query)
 			if result != tt.expected {
-				t.Errorf("extractTableName(%q) = %q, want %q", tt.query, result, tt.expected)
+				t.Errorf("extractTableRef(%q) = %+v, want %+v", tt.query, result, tt.expected)
 			}
 		})
 	}
@@ -64,54 +94,66 @@ func TestExtractTableName(t *testing.T) {
 
 func TestBuildProjectedQuery(t *testing.T) {
 	tests := []struct {
-		name      string
-		tableName string
-		columns   []string
-		expected  string
+		name     string
+		table    TableRef
+		columns  []string
+		expected string
 	}{
 		{
-			name:      "single column",
-			tableName: "Order",
-			columns:   []string{"id"},
-			expected:  `SELECT "id" FROM "Order"`,
+			name:     "single column",
+			table:    TableRef{Name: "Order"},
+			columns:  []string{"id"},
+			expected: `SELECT "id" FROM "Order"`,
+		},
+		{
+			name:     "multiple columns",
+			table:    TableRef{Name: "Order"},
+			columns:  []string{"id", "name", "status"},
+			expected: `SELECT "id", "name", "status" FROM "Order"`,
 		},
 		{
-			name:      "multiple columns",
-			tableName: "Order",
-			columns:   []string{"id", "name", "status"},
-			expected:  `SELECT "id", "name", "status" FROM "Order"`,
+			name:     "empty columns - SELECT *",
+			table:    TableRef{Name: "Order"},
+			columns:  []string{},
+			expected: `SELECT * FROM "Order"`,
 		},
 		{
-			name:      "empty columns - SELECT *",
-			tableName: "Order",
-			columns:   []string{},
-			expected:  `SELECT * FROM "Order"`,
+			name:     "nil columns - SELECT *",
+			table:    TableRef{Name: "Order"},
+			columns:  nil,
+			expected: `SELECT * FROM "Order"`,
 		},
 		{
-			name:      "nil columns - SELECT *",
-			tableName: "Order",
-			columns:   nil,
-			expected:  `SELECT * FROM "Order"`,
+			name:     "table name with quotes",
+			table:    TableRef{Name: `My"Table`},
+			columns:  []string{"col1"},
+			expected: `SELECT "col1" FROM "My""Table"`,
 		},
 		{
-			name:      "table name with quotes",
-			tableName: `My"Table`,
-			columns:   []string{"col1"},
-			expected:  `SELECT "col1" FROM "My""Table"`,
+			name:     "schema-qualified table",
+			table:    TableRef{Schema: "sales", Name: "Orders"},
+			columns:  []string{"id"},
+			expected: `SELECT "id" FROM "sales"."Orders"`,
 		},
 		{
-			name:      "column name with quotes",
-			tableName: "Order",
-			columns:   []string{`col"1`, "col2"},
-			expected:  `SELECT "col""1", "col2" FROM "Order"`,
+			name:     "catalog-qualified table",
+			table:    TableRef{Catalog: "wh", Schema: `s"1`, Name: "Orders"},
+			columns:  nil,
+			expected: `SELECT * FROM "wh"."s""1"."Orders"`,
+		},
+		{
+			name:     "column name with quotes",
+			table:    TableRef{Name: "Order"},
+			columns:  []string{`col"1`, "col2"},
+			expected: `SELECT "col""1", "col2" FROM "Order"`,
 		},
 	}
 
 	for _, tt := range tests {
 		t.Run(tt.name, func(t *testing.T) {
-			result := buildProjectedQuery(tt.tableName, tt.columns)
+			result := buildProjectedQuery(tt.table, tt.columns)
 			if result != tt.expected {
-				t.Errorf("buildProjectedQuery(%q, %v) = %q, want %q", tt.tableName, tt.columns, result, tt.expected)
+				t.Errorf("buildProjectedQuery(%+v, %v) = %q, want %q", tt.table, tt.columns, result, tt.expected)
 			}
 		})
 	}
@@ -119,28 +161,244 @@ func TestBuildProjectedQuery(t *testing.T) {
 
 func TestBuildSchemaQuery(t *testing.T) {
 	tests := []struct {
-		name      string
-		tableName string
-		expected  string
+		name     string
+		table    TableRef
+		expected string
+	}{
+		{
+			name:     "simple table",
+			table:    TableRef{Name: "Order"},
+			expected: `SELECT * FROM "Order" WHERE 1=0`,
+		},
+		{
+			name:     "table with quotes",
+			table:    TableRef{Name: `My"Table`},
+			expected: `SELECT * FROM "My""Table" WHERE 1=0`,
+		},
+		{
+			name:     "schema-qualified table",
+			table:    TableRef{Schema: "sales", Name: "Orders"},
+			expected: `SELECT * FROM "sales"."Orders" WHERE 1=0`,
+		},
+	}
+
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			result := buildSchemaQuery(tt.table)
+			if result != tt.expected {
+				t.Errorf("buildSchemaQuery(%+v) = %q, want %q", tt.table, result, tt.expected)
+			}
+		})
+	}
+}
+
+func TestParseTableName(t *testing.T) {
+	tests := []struct {
+		name     string
+		input    string
+		expected TableRef
+		wantErr  bool
+	}{
+		{name: "unqualified", input: "Orders", expected: TableRef{Name: "Orders"}},
+		{name: "schema-qualified", input: "sales.Orders", expected: TableRef{Schema: "sales", Name: "Orders"}},
+		{name: "catalog-qualified", input: "wh.sales.Orders", expected: TableRef{Catalog: "wh", Schema: "sales", Name: "Orders"}},
+		{name: "quoted name keeps its dot", input: `"a.b"`, expected: TableRef{Name: "a.b"}},
+		{name: "quoted parts", input: `"sales"."a.b"`, expected: TableRef{Schema: "sales", Name: "a.b"}},
+		{name: "one pair of quotes stripped", input: `""table""`, expected: TableRef{Name: `"table"`}},
+		{name: "too many parts", input: "a.b.c.d", wantErr: true},
+	}
+
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			result, err := parseTableName(tt.input)
+			if (err != nil) != tt.wantErr {
+				t.Fatalf("parseTableName(%q) error = %v, wantErr %v", tt.input, err, tt.wantErr)
+			}
+			if result != tt.expected {
+				t.Errorf("parseTableName(%q) = %+v, want %+v", tt.input, result, tt.expected)
+			}
+		})
+	}
+}
+
+func TestProjectableQuery(t *testing.T) {
+	tests := []struct {
+		name     string
+		query    string
+		expected string
+		ok       bool
+	}{
+		{name: "select", query: `SELECT a, b FROM t WHERE a > 1`, expected: `SELECT a, b FROM t WHERE a > 1`, ok: true},
+		{name: "with", query: "with x as (select 1 as a) select a from x", expected: "with x as (select 1 as a) select a from x", ok: true},
+		{name: "trailing semicolon", query: "  SELECT a FROM t;  ", expected: "SELECT a FROM t", ok: true},
+		{name: "order by", query: "SELECT a FROM t ORDER BY a", expected: "SELECT a FROM t ORDER BY a", ok: false},
+		{name: "multiple statements", query: "SELECT 1; SELECT 2", expected: "SELECT 1; SELECT 2", ok: false},
+		{name: "not a query", query: "SHOW TABLES", expected: "SHOW TABLES", ok: false},
+		{name: "select prefix of a word", query: "SELECTED", expected: "SELECTED", ok: false},
+	}
+
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			result, ok := projectableQuery(tt.query)
+			if result != tt.expected || ok != tt.ok {
+				t.Errorf("projectableQuery(%q) = %q, %v, want %q, %v", tt.query, result, ok, tt.expected, tt.ok)
+			}
+		})
+	}
+}
+
+func TestBuildSubqueryProjection(t *testing.T) {
+	const query = `SELECT a, b, c FROM t -- comment`
+	tests := []struct {
+		name       string
+		columns    []string
+		allColumns []string
+		expected   string
+	}{
+		{
+			name:       "subset",
+			columns:    []string{"c", "a"},
+			allColumns: []string{"a", "b", "c"},
+			expected:   "SELECT \"c\", \"a\" FROM (\n" + query + "\n) AS duckarrow_subquery",
+		},
+		{
+			name:       "all columns in order",
+			columns:    []string{"a", "b", "c"},
+			allColumns: []string{"a", "b", "c"},
+			expected:   query,
+		},
+		{
+			name:       "no columns",
+			columns:    nil,
+			allColumns: []string{"a", "b", "c"},
+			expected:   query,
+		},
+		{
+			name:       "column name with quotes",
+			columns:    []string{`a"b`},
+			allColumns: []string{`a"b`, "c"},
+			expected:   "SELECT \"a\"\"b\" FROM (\n" + query + "\n) AS duckarrow_subquery",
+		},
+	}
+
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			result := buildSubqueryProjection(query, tt.columns, tt.allColumns)
+			if result != tt.expected {
+				t.Errorf("buildSubqueryProjection(%v) = %q, want %q", tt.columns, result, tt.expected)
+			}
+		})
+	}
+}
+
+func TestParseAggregates(t *testing.T) {
+	aggs, err := parseAggregates(`count(*), SUM(total), avg("Unit, Price")`)
+	if err != nil {
+		t.Fatal(err)
+	}
+	want := []aggregate{{Func: "COUNT"}, {Func: "SUM", Column: "total"}, {Func: "AVG", Column: "Unit, Price"}}
+	if len(aggs) != len(want) {
+		t.Fatalf("parseAggregates = %+v, want %+v", aggs, want)
+	}
+	for i := range want {
+		if aggs[i] != want[i] {
+			t.Errorf("aggs[%d] = %+v, want %+v", i, aggs[i], want[i])
+		}
+	}
+	names := map[aggregate]string{
+		aggs[0]:                             "count(*)",
+		aggs[1]:                             "sum(total)",
+		aggs[2]:                             `avg("Unit, Price")`,
+		{Func: "MAX", Column: "Unit Price"}: `max("Unit Price")`,
+		{Func: "MIN", Column: "UnitPrice"}:  `min("UnitPrice")`,
+		{Func: "SUM", Column: `a"b`}:        `sum("a""b")`,
+	}
+	for agg, want := range names {
+		if got := agg.Name(); got != want {
+			t.Errorf("%+v.Name() = %q, want %q", agg, got, want)
+		}
+	}
+
+	for _, bad := range []string{"", "sum(*)", "median(total)", "sum(total) + 1", "sum(a; DROP TABLE t)"} {
+		if _, err := parseAggregates(bad); err == nil {
+			t.Errorf("parseAggregates(%q) should fail", bad)
+		}
+	}
+}
+
+func TestBuildAggregateQuery(t *testing.T) {
+	tests := []struct {
+		name     string
+		table    TableRef
+		groupBy  string
+		aggs     string
+		filter   string
+		expected string
 	}{
 		{
-			name:      "simple table",
-			tableName: "Order",
-			expected:  `SELECT * FROM "Order" WHERE 1=0`,
+			name:     "grouped",
+			table:    TableRef{Name: "Orders"},
+			groupBy:  "status",
+			aggs:     "count(*), sum(total)",
+			expected: `SELECT "status", COUNT(*) AS "count(*)", SUM("total") AS "sum(total)" FROM "Orders" GROUP BY "status"`,
 		},
 		{
-			name:      "table with quotes",
-			tableName: `My"Table`,
-			expected:  `SELECT * FROM "My""Table" WHERE 1=0`,
+			name:     "no groups with filter",
+			table:    TableRef{Schema: "sales", Name: "Orders"},
+			aggs:     "max(total)",
+			filter:   "total > 100",
+			expected: `SELECT MAX("total") AS "max(total)" FROM "sales"."Orders" WHERE (total > 100)`,
+		},
+		{
+			name:     "quoted aggregate column with mixed case and a space",
+			table:    TableRef{Name: "Orders"},
+			aggs:     `avg("Unit Price")`,
+			expected: `SELECT AVG("Unit Price") AS "avg(""Unit Price"")" FROM "Orders"`,
+		},
+		{
+			name:     "quoted group columns",
+			table:    TableRef{Name: "Orders"},
+			groupBy:  `region, "Order""Status"`,
+			aggs:     "min(total)",
+			expected: `SELECT "region", "Order""Status", MIN("total") AS "min(total)" FROM "Orders" GROUP BY "region", "Order""Status"`,
 		},
 	}
 
 	for _, tt := range tests {
 		t.Run(tt.name, func(t *testing.T) {
-			result := buildSchemaQuery(tt.tableName)
+			groups, err := parseColumnList(tt.groupBy)
+			if err != nil {
+				t.Fatal(err)
+			}
+			aggs, err := parseAggregates(tt.aggs)
+			if err != nil {
+				t.Fatal(err)
+			}
+			result := buildAggregateQuery(tt.table, groups, aggs, tt.filter)
 			if result != tt.expected {
-				t.Errorf("buildSchemaQuery(%q) = %q, want %q", tt.tableName, result, tt.expected)
+				t.Errorf("buildAggregateQuery = %q, want %q", result, tt.expected)
 			}
 		})
 	}
+
+	if _, err := parseColumnList(`status; DROP TABLE t`); err == nil {
+		t.Error("parseColumnList should reject a non-identifier")
+	}
+}
+
+func TestUniqueColumns(t *testing.T) {
+	// Columns of SELECT 1 AS a, 2 AS a, 3 AS b: projecting "a" or "b" by name
+	// is ambiguous or misaligned, so bind must execute the query as given
+	if uniqueColumns([]string{"a", "a", "b"}) {
+		t.Error("uniqueColumns should report the duplicate a")
+	}
+	if uniqueColumns([]string{"a", "b", "A"}) {
+		t.Error("uniqueColumns should compare names case-insensitively")
+	}
+	if !uniqueColumns([]string{"a", "b"}) {
+		t.Error("uniqueColumns([a b]) should be true")
+	}
+	if !uniqueColumns(nil) {
+		t.Error("uniqueColumns(nil) should be true")
+	}
 }
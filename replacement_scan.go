@@ -14,10 +14,10 @@ import (
 	"duckdb"
 	"fmt"
 	"runtime"
-	"strings"
 	"sync"
 	"unsafe"
 
+	"main/internal/tracing"
 	"main/internal/validation"
 )
 
@@ -77,8 +77,19 @@ func validateTableName(name string) error {
 	return validation.ValidateTableName(name)
 }
 
+// validateTableRef validates the table name and any schema or catalog.
+func validateTableRef(table TableRef) error {
+	for _, part := range table.parts() {
+		if err := validateTableName(part); err != nil {
+			return err
+		}
+	}
+	return nil
+}
+
 // duckarrow_replacement_scan_callback is called by DuckDB when it encounters an unknown table
-// in the "duckarrow" schema. It rewrites the query to use our duckarrow_query table function.
+// in the "duckarrow" schema. It rewrites the reference to our duckarrow_scan table function,
+// passing the table as separate catalog, schema and name parameters.
 //
 // Thread safety: This callback may be invoked from multiple DuckDB threads concurrently.
 // The URI is read atomically via GetDuckArrowURI(). If the URI changes during query execution,
@@ -98,52 +109,52 @@ func duckarrow_replacement_scan_callback(info C.duckdb_replacement_scan_info, ta
 		return
 	}
 
-	// Strip exactly one pair of surrounding quotes if present (DuckDB may pass quoted identifiers)
-	// Using strings.Trim would incorrectly strip ALL quotes from names like ""table"" -> table
-	// Instead, we only strip one pair: ""table"" -> "table" (a table name containing quotes)
-	actualTable := name
-	if len(name) >= 2 && name[0] == '"' && name[len(name)-1] == '"' {
-		actualTable = name[1 : len(name)-1]
-	}
+	// Split schema- and catalog-qualified names: duckarrow."sales.Orders"
+	// reaches us as sales.Orders. Each part has one pair of surrounding
+	// quotes stripped (DuckDB may pass quoted identifiers).
+	table, parseErr := parseTableName(name)
 
 	// Skip if it looks like a DuckDB internal or system table
-	if validation.ShouldSkipTable(actualTable) {
+	if parseErr == nil && validation.ShouldSkipTable(table.Name) {
 		return
 	}
 
-	// Validate table name to prevent SQL injection on the remote server
-	if err := validateTableName(actualTable); err != nil {
+	tr := tracing.Default.Begin("replacement_scan", name)
+	defer tr.End()
+
+	// Validate every part to prevent SQL injection on the remote server
+	err := parseErr
+	if err == nil {
+		err = validateTableRef(table)
+	}
+	if err != nil {
+		tr.Arg("error", err.Error())
 		errCStr := C.CString(fmt.Sprintf("duckarrow: %s", err.Error()))
 		C.duckdb_replacement_scan_set_error(info, errCStr)
 		C.free(unsafe.Pointer(errCStr))
 		return
 	}
 
-	// Escape embedded double quotes to prevent SQL injection
-	// In SQL, a literal double quote inside a quoted identifier is escaped by doubling it
-	escapedTable := strings.ReplaceAll(actualTable, `"`, `""`)
-
-	// Generate the query - quote the table name for safety
-	query := fmt.Sprintf(`SELECT * FROM "%s"`, escapedTable)
+	tr.Arg("table", table.SQL())
 
 	// Set the function name to our table function
-	funcName := C.CString("duckarrow_query")
+	funcName := C.CString("duckarrow_scan")
 	defer C.free(unsafe.Pointer(funcName))
 	C.duckdb_replacement_scan_set_function_name(info, funcName)
 
-	// Add URI parameter
-	uriCStr := C.CString(uri)
-	uriValue := C.duckdb_create_varchar(uriCStr)
-	C.free(unsafe.Pointer(uriCStr))
-	C.duckdb_replacement_scan_add_parameter(info, uriValue)
-	C.duckdb_destroy_value(&uriValue)
-
-	// Add query parameter
-	queryCStr := C.CString(query)
-	queryValue := C.duckdb_create_varchar(queryCStr)
-	C.free(unsafe.Pointer(queryCStr))
-	C.duckdb_replacement_scan_add_parameter(info, queryValue)
-	C.duckdb_destroy_value(&queryValue)
+	// The C API only passes positional parameters to replacement functions
+	for _, param := range []string{uri, table.Catalog, table.Schema, table.Name} {
+		addReplacementParameter(info, param)
+	}
+}
+
+// addReplacementParameter appends a VARCHAR parameter to the replacement call.
+func addReplacementParameter(info C.duckdb_replacement_scan_info, param string) {
+	cStr := C.CString(param)
+	value := C.duckdb_create_varchar(cStr)
+	C.free(unsafe.Pointer(cStr))
+	C.duckdb_replacement_scan_add_parameter(info, value)
+	C.duckdb_destroy_value(&value)
 }
 
 // RegisterReplacementScan registers the duckarrow replacement scan with the database
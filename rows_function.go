@@ -0,0 +1,256 @@
+package main
+
+/*
+#cgo CFLAGS: -I${SRCDIR}/duckdb-go-api -DDUCKDB_API_EXCLUDE_FUNCTIONS=1
+#include <stdlib.h>
+#include <duckdb.h>
+#include <duckdb_go_extension.h>
+
+// Callback wrappers - these call back into Go
+void duckarrow_rows_bind(duckdb_bind_info info);
+void duckarrow_rows_init(duckdb_init_info info);
+void duckarrow_rows_scan(duckdb_function_info info, duckdb_data_chunk output);
+void duckarrow_rows_destroy(void *data);
+*/
+import "C"
+import (
+	"duckdb"
+	"fmt"
+	"runtime"
+	"runtime/cgo"
+	"time"
+	"unsafe"
+)
+
+// rowsColumn describes one output column of a rowsFunction.
+type rowsColumn struct {
+	Name string
+	Type C.duckdb_type // VARCHAR, BIGINT, DOUBLE, BOOLEAN or TIMESTAMP
+}
+
+// rowsFunction is a small table function whose whole result is computed at bind
+// time. It backs the introspection functions (duckarrow_stats() and friends),
+// which return at most a few thousand rows and need no projection pushdown.
+//
+// Row values are Go values matching the column type: string for VARCHAR, int64
+// for BIGINT, float64 for DOUBLE, bool for BOOLEAN and time.Time for TIMESTAMP.
+// A nil value is emitted as NULL.
+type rowsFunction struct {
+	Name    string
+	Params  int      // Number of positional VARCHAR parameters passed to Rows
+	Named   []string // Optional named VARCHAR parameters, passed to Rows after the positional ones ("" if not given)
+	Columns []rowsColumn
+	Rows    func(args []string) ([][]any, error)
+}
+
+// rowsBindData holds the materialized result of a rowsFunction call.
+type rowsBindData struct {
+	fn   *rowsFunction
+	rows [][]any
+}
+
+// rowsScanState tracks how many rows have been emitted.
+type rowsScanState struct {
+	position int
+}
+
+//export duckarrow_rows_bind
+func duckarrow_rows_bind(info C.duckdb_bind_info) {
+	runtime.LockOSThread()
+	defer runtime.UnlockOSThread()
+
+	fnHandle := cgo.Handle(uintptr(C.duckdb_bind_get_extra_info(info)))
+	fn, ok := fnHandle.Value().(*rowsFunction)
+	if !ok {
+		duckdb.SetBindError(duckdb.BindInfo{Ptr: unsafe.Pointer(info)}, "internal error: invalid rows function")
+		return
+	}
+
+	args := make([]string, fn.Params+len(fn.Named))
+	for i := 0; i < fn.Params; i++ {
+		args[i] = rowsVarchar(C.duckdb_bind_get_parameter(info, C.idx_t(i)))
+	}
+	for i, name := range fn.Named {
+		cName := C.CString(name)
+		if val := C.duckdb_bind_get_named_parameter(info, cName); val != nil {
+			args[fn.Params+i] = rowsVarchar(val)
+		}
+		C.free(unsafe.Pointer(cName))
+	}
+
+	rows, err := fn.Rows(args)
+	if err != nil {
+		duckdb.SetBindError(duckdb.BindInfo{Ptr: unsafe.Pointer(info)}, "%s: %v", fn.Name, err)
+		return
+	}
+
+	for _, col := range fn.Columns {
+		colName := C.CString(col.Name)
+		colType := C.duckdb_create_logical_type(col.Type)
+		C.duckdb_bind_add_result_column(info, colName, colType)
+		C.duckdb_destroy_logical_type(&colType)
+		C.free(unsafe.Pointer(colName))
+	}
+	C.duckdb_bind_set_cardinality(info, C.idx_t(len(rows)), true)
+
+	handle := cgo.NewHandle(&rowsBindData{fn: fn, rows: rows})
+	C.duckdb_bind_set_bind_data(info, unsafe.Pointer(handle),
+		C.duckdb_delete_callback_t(C.duckarrow_rows_destroy))
+}
+
+// rowsVarchar reads a parameter value as a string and destroys the value.
+func rowsVarchar(val C.duckdb_value) string {
+	cStr := C.duckdb_get_varchar(val)
+	s := C.GoString(cStr)
+	C.duckdb_free(unsafe.Pointer(cStr))
+	C.duckdb_destroy_value(&val)
+	return s
+}
+
+//export duckarrow_rows_init
+func duckarrow_rows_init(info C.duckdb_init_info) {
+	runtime.LockOSThread()
+	defer runtime.UnlockOSThread()
+
+	handle := cgo.NewHandle(&rowsScanState{})
+	C.duckdb_init_set_init_data(info, unsafe.Pointer(handle),
+		C.duckdb_delete_callback_t(C.duckarrow_rows_destroy))
+}
+
+//export duckarrow_rows_scan
+func duckarrow_rows_scan(info C.duckdb_function_info, output C.duckdb_data_chunk) {
+	runtime.LockOSThread()
+	defer runtime.UnlockOSThread()
+
+	bindData, ok := cgo.Handle(uintptr(C.duckdb_function_get_bind_data(info))).Value().(*rowsBindData)
+	if !ok {
+		duckdb.SetFunctionError(duckdb.FunctionInfo{Ptr: unsafe.Pointer(info)}, "internal error: invalid bind data type")
+		return
+	}
+	state, ok := cgo.Handle(uintptr(C.duckdb_function_get_init_data(info))).Value().(*rowsScanState)
+	if !ok {
+		duckdb.SetFunctionError(duckdb.FunctionInfo{Ptr: unsafe.Pointer(info)}, "internal error: invalid scan state type")
+		return
+	}
+
+	rowsToEmit := min(len(bindData.rows)-state.position, maxDuckDBChunkSize)
+	if rowsToEmit <= 0 {
+		C.duckdb_data_chunk_set_size(output, 0)
+		return
+	}
+
+	for colIdx, col := range bindData.fn.Columns {
+		vec := C.duckdb_data_chunk_get_vector(output, C.idx_t(colIdx))
+		for i := 0; i < rowsToEmit; i++ {
+			row := bindData.rows[state.position+i]
+			if err := writeRowsValue(vec, col, i, row[colIdx]); err != nil {
+				duckdb.SetFunctionError(duckdb.FunctionInfo{Ptr: unsafe.Pointer(info)}, "%s: column %q: %v", bindData.fn.Name, col.Name, err)
+				return
+			}
+		}
+	}
+
+	state.position += rowsToEmit
+	C.duckdb_data_chunk_set_size(output, C.idx_t(rowsToEmit))
+}
+
+// writeRowsValue writes a single Go value into row i of a DuckDB vector.
+func writeRowsValue(vec C.duckdb_vector, col rowsColumn, i int, value any) error {
+	if value == nil {
+		C.duckdb_vector_ensure_validity_writable(vec)
+		C.duckdb_validity_set_row_invalid(C.duckdb_vector_get_validity(vec), C.idx_t(i))
+		return nil
+	}
+
+	data := C.duckdb_vector_get_data(vec)
+	switch col.Type {
+	case C.DUCKDB_TYPE_VARCHAR:
+		s, ok := value.(string)
+		if !ok {
+			return fmt.Errorf("expected string, got %T", value)
+		}
+		duckdb.AssignStringToVector(duckdb.Vector{Ptr: unsafe.Pointer(vec)}, i, s)
+	case C.DUCKDB_TYPE_BIGINT:
+		v, ok := value.(int64)
+		if !ok {
+			return fmt.Errorf("expected int64, got %T", value)
+		}
+		unsafe.Slice((*C.int64_t)(data), i+1)[i] = C.int64_t(v)
+	case C.DUCKDB_TYPE_DOUBLE:
+		v, ok := value.(float64)
+		if !ok {
+			return fmt.Errorf("expected float64, got %T", value)
+		}
+		unsafe.Slice((*C.double)(data), i+1)[i] = C.double(v)
+	case C.DUCKDB_TYPE_BOOLEAN:
+		v, ok := value.(bool)
+		if !ok {
+			return fmt.Errorf("expected bool, got %T", value)
+		}
+		var b C.uint8_t
+		if v {
+			b = 1
+		}
+		unsafe.Slice((*C.uint8_t)(data), i+1)[i] = b
+	case C.DUCKDB_TYPE_TIMESTAMP:
+		v, ok := value.(time.Time)
+		if !ok {
+			return fmt.Errorf("expected time.Time, got %T", value)
+		}
+		// DuckDB TIMESTAMP is microseconds since epoch
+		unsafe.Slice((*C.int64_t)(data), i+1)[i] = C.int64_t(v.UnixMicro())
+	default:
+		return fmt.Errorf("unsupported column type %d", col.Type)
+	}
+	return nil
+}
+
+//export duckarrow_rows_destroy
+func duckarrow_rows_destroy(data unsafe.Pointer) {
+	if data == nil {
+		return
+	}
+	cgo.Handle(uintptr(data)).Delete()
+}
+
+// durationMillis converts a duration to fractional milliseconds for output columns.
+func durationMillis(d time.Duration) float64 {
+	return float64(d) / float64(time.Millisecond)
+}
+
+// registerRowsFunction registers fn as a DuckDB table function.
+// The rowsFunction must stay alive for the lifetime of the database, which is
+// guaranteed by the handle stored as the function's extra info.
+func registerRowsFunction(conn duckdb.Connection, fn *rowsFunction) duckdb.State {
+	tableFunc := C.duckdb_create_table_function()
+	defer C.duckdb_destroy_table_function(&tableFunc)
+
+	name := C.CString(fn.Name)
+	defer C.free(unsafe.Pointer(name))
+	C.duckdb_table_function_set_name(tableFunc, name)
+
+	varcharType := C.duckdb_create_logical_type(C.DUCKDB_TYPE_VARCHAR)
+	for i := 0; i < fn.Params; i++ {
+		C.duckdb_table_function_add_parameter(tableFunc, varcharType)
+	}
+	for _, named := range fn.Named {
+		cName := C.CString(named)
+		C.duckdb_table_function_add_named_parameter(tableFunc, cName, varcharType)
+		C.free(unsafe.Pointer(cName))
+	}
+	C.duckdb_destroy_logical_type(&varcharType)
+
+	handle := cgo.NewHandle(fn)
+	C.duckdb_table_function_set_extra_info(tableFunc, unsafe.Pointer(handle),
+		C.duckdb_delete_callback_t(C.duckarrow_rows_destroy))
+
+	C.duckdb_table_function_set_bind(tableFunc,
+		C.duckdb_table_function_bind_t(C.duckarrow_rows_bind))
+	C.duckdb_table_function_set_init(tableFunc,
+		C.duckdb_table_function_init_t(C.duckarrow_rows_init))
+	C.duckdb_table_function_set_function(tableFunc,
+		C.duckdb_table_function_t(C.duckarrow_rows_scan))
+
+	return duckdb.State(C.duckdb_register_table_function(
+		C.duckdb_connection(conn.Ptr), tableFunc))
+}
@@ -0,0 +1,216 @@
+package main
+
+/*
+#cgo CFLAGS: -I${SRCDIR}/duckdb-go-api -DDUCKDB_API_EXCLUDE_FUNCTIONS=1
+#include <duckdb.h>
+#include <duckdb_go_extension.h>
+*/
+import "C"
+import (
+	"duckdb"
+	"strconv"
+	"sync/atomic"
+	"time"
+
+	"main/internal/convert"
+	"main/internal/flight"
+	"main/internal/settings"
+	"main/internal/slowlog"
+	"main/internal/tracing"
+)
+
+// wideDecimals holds the wide_decimal setting as a convert.DecimalMode.
+var wideDecimals atomic.Int32
+
+// currentConvertOptions returns the conversion settings for a scan being bound.
+func currentConvertOptions() convert.Options {
+	return convert.Options{WideDecimals: convert.DecimalMode(wideDecimals.Load())}
+}
+
+func init() {
+	settings.Default.Define(settings.Setting{
+		Name:        "trace_file",
+		Description: "New Chrome trace event file for scan timelines; empty disables tracing",
+		Default:     "",
+		Get:         tracing.Default.Path,
+		Set: func(path string) error {
+			if path != "" {
+				if err := requireExternalAccess(); err != nil {
+					return err
+				}
+			}
+			return tracing.Default.Open(path)
+		},
+	})
+	settings.Default.Define(settings.Setting{
+		Name:        "trace_sample_rate",
+		Description: "Fraction of scans recorded in the trace file (0 to 1)",
+		Default:     "1",
+		Get: func() string {
+			return strconv.FormatFloat(tracing.Default.SampleRate(), 'g', -1, 64)
+		},
+		Set: func(value string) error {
+			rate, err := settings.ParseFraction(value)
+			if err != nil {
+				return err
+			}
+			return tracing.Default.SetSampleRate(rate)
+		},
+	})
+
+	settings.Default.Define(settings.Setting{
+		Name:        "slow_log_file",
+		Description: "JSON Lines file for slow remote queries, DDL and scans; empty disables the log",
+		Default:     "",
+		Get:         slowlog.Default.Path,
+		Set:         slowlog.Default.Open,
+	})
+	defineSlowLogThreshold("slow_log_min_ms", "Log operations taking at least this many milliseconds in total (0 disables)", "1000",
+		func(t *slowlog.Thresholds) *int64 { return (*int64)(&t.Total) }, int64(time.Millisecond))
+	defineSlowLogThreshold("slow_log_min_first_batch_ms", "Log scans waiting at least this many milliseconds for the first batch (0 disables)", "0",
+		func(t *slowlog.Thresholds) *int64 { return (*int64)(&t.FirstBatch) }, int64(time.Millisecond))
+	defineSlowLogThreshold("slow_log_min_bytes", "Log scans receiving at least this many Arrow bytes (0 disables)", "0",
+		func(t *slowlog.Thresholds) *int64 { return &t.Bytes }, 1)
+	settings.Default.Define(settings.Setting{
+		Name:        "slow_log_sample_rate",
+		Description: "Fraction of slow operations written to the slow log (0 to 1)",
+		Default:     "1",
+		Get: func() string {
+			return strconv.FormatFloat(slowlog.Default.SampleRate(), 'g', -1, 64)
+		},
+		Set: func(value string) error {
+			rate, err := settings.ParseFraction(value)
+			if err != nil {
+				return err
+			}
+			return slowlog.Default.SetSampleRate(rate)
+		},
+	})
+
+	settings.Default.Define(settings.Setting{
+		Name:        "batch_rows",
+		Description: "Preferred rows per result batch, rounded up to a multiple of 2048, as N or URI=N entries (0 lets the server choose)",
+		Default:     "0",
+		Get:         flight.BatchRows.String,
+		Set:         flight.BatchRows.Set,
+	})
+	settings.Default.Define(settings.Setting{
+		Name:        "batch_bytes",
+		Description: "Preferred bytes per result batch, as N or URI=N entries (0 lets the server choose)",
+		Default:     "0",
+		Get:         flight.BatchBytes.String,
+		Set:         flight.BatchBytes.Set,
+	})
+	settings.Default.Define(settings.Setting{
+		Name:        "catalog_ttl_seconds",
+		Description: "Seconds a remote table listing is served before a background refresh (0 disables the cache)",
+		Default:     strconv.FormatInt(int64(flight.DefaultCatalogTTL/time.Second), 10),
+		Get: func() string {
+			return strconv.FormatInt(int64(flight.Catalog.TTL()/time.Second), 10)
+		},
+		Set: func(value string) error {
+			n, err := settings.ParseNonNegative(value)
+			if err != nil {
+				return err
+			}
+			flight.Catalog.SetTTL(time.Duration(n) * time.Second)
+			return nil
+		},
+	})
+
+	settings.Default.Define(settings.Setting{
+		Name:        "wide_decimal",
+		Description: "DuckDB type for decimals over 38 digits: decimal (DECIMAL(38), error on overflow), double or varchar",
+		Default:     convert.DecimalChecked.String(),
+		Get: func() string {
+			return convert.DecimalMode(wideDecimals.Load()).String()
+		},
+		Set: func(value string) error {
+			mode, err := convert.ParseDecimalMode(value)
+			if err != nil {
+				return err
+			}
+			wideDecimals.Store(int32(mode))
+			return nil
+		},
+	})
+}
+
+// defineSlowLogThreshold defines a setting for one slow log threshold. field
+// selects the threshold and unit converts the setting's value to it.
+func defineSlowLogThreshold(name, description, def string, field func(*slowlog.Thresholds) *int64, unit int64) {
+	settings.Default.Define(settings.Setting{
+		Name:        name,
+		Description: description,
+		Default:     def,
+		Get: func() string {
+			t := slowlog.Default.Thresholds()
+			return strconv.FormatInt(*field(&t)/unit, 10)
+		},
+		Set: func(value string) error {
+			n, err := settings.ParseNonNegative(value)
+			if err != nil {
+				return err
+			}
+			t := slowlog.Default.Thresholds()
+			*field(&t) = n * unit
+			return slowlog.Default.SetThresholds(t)
+		},
+	})
+}
+
+// duckarrowSetFunction changes an extension setting.
+//
+// Usage in SQL:
+//
+//	SELECT duckarrow_set('trace_file', '/tmp/duckarrow.trace.json');
+//	SELECT duckarrow_set('trace_sample_rate', '0.1');
+//	SELECT duckarrow_set('trace_file', 'default');  -- restore the default
+var duckarrowSetFunction = &commandFunction{
+	Name:   "duckarrow_set",
+	Params: 2,
+	Call: func(args []string) (string, error) {
+		if err := settings.Default.Set(args[0], args[1]); err != nil {
+			return "", err
+		}
+		value, err := settings.Default.Get(args[0])
+		if err != nil {
+			return "", err
+		}
+		return args[0] + " = " + strconv.Quote(value), nil
+	},
+}
+
+// duckarrowSettingsFunction lists every extension setting with its current value.
+//
+// Usage in SQL:
+//
+//	SELECT * FROM duckarrow_settings();
+var duckarrowSettingsFunction = &rowsFunction{
+	Name: "duckarrow_settings",
+	Columns: []rowsColumn{
+		{"name", C.DUCKDB_TYPE_VARCHAR},
+		{"value", C.DUCKDB_TYPE_VARCHAR},
+		{"default", C.DUCKDB_TYPE_VARCHAR},
+		{"description", C.DUCKDB_TYPE_VARCHAR},
+	},
+	Rows: func(_ []string) ([][]any, error) {
+		all := settings.Default.All()
+		rows := make([][]any, len(all))
+		for i, s := range all {
+			rows[i] = []any{s.Name, s.Get(), s.Default, s.Description}
+		}
+		return rows, nil
+	},
+}
+
+// RegisterDuckArrowSettingsFunctions registers duckarrow_set() and duckarrow_settings().
+//
+// Returns:
+//   - duckdb.STATE_OK on success, duckdb.STATE_ERROR on failure
+func RegisterDuckArrowSettingsFunctions(conn duckdb.Connection) duckdb.State {
+	if state := registerCommandFunction(conn, duckarrowSetFunction); state == duckdb.STATE_ERROR {
+		return state
+	}
+	return registerRowsFunction(conn, duckarrowSettingsFunction)
+}
@@ -0,0 +1,140 @@
+package main
+
+/*
+#cgo CFLAGS: -I${SRCDIR}/duckdb-go-api -DDUCKDB_API_EXCLUDE_FUNCTIONS=1
+#include <duckdb.h>
+#include <duckdb_go_extension.h>
+*/
+import "C"
+import (
+	"duckdb"
+	"fmt"
+	"strings"
+
+	"main/internal/stats"
+)
+
+// duckarrowStatsFunction returns the most recent finished remote scans, newest first.
+//
+// Usage in SQL:
+//
+//	SELECT query_id, sql, rows, bytes, next_ms, convert_ms FROM duckarrow_stats();
+var duckarrowStatsFunction = &rowsFunction{
+	Name: "duckarrow_stats",
+	Columns: []rowsColumn{
+		{"query_id", C.DUCKDB_TYPE_BIGINT},
+		{"started_at", C.DUCKDB_TYPE_TIMESTAMP},
+		{"uri", C.DUCKDB_TYPE_VARCHAR},
+		{"sql", C.DUCKDB_TYPE_VARCHAR},
+		{"bind_ms", C.DUCKDB_TYPE_DOUBLE},
+		{"query_ms", C.DUCKDB_TYPE_DOUBLE},
+		{"first_batch_ms", C.DUCKDB_TYPE_DOUBLE},
+		{"total_ms", C.DUCKDB_TYPE_DOUBLE},
+		{"batches", C.DUCKDB_TYPE_BIGINT},
+		{"bytes", C.DUCKDB_TYPE_BIGINT},
+		{"rows", C.DUCKDB_TYPE_BIGINT},
+		{"min_batch_rows", C.DUCKDB_TYPE_BIGINT},
+		{"max_batch_rows", C.DUCKDB_TYPE_BIGINT},
+		{"next_ms", C.DUCKDB_TYPE_DOUBLE},
+		{"convert_ms", C.DUCKDB_TYPE_DOUBLE},
+		{"convert_by_type", C.DUCKDB_TYPE_VARCHAR},
+		{"error", C.DUCKDB_TYPE_VARCHAR},
+	},
+	Rows: func(_ []string) ([][]any, error) {
+		recent := stats.Default.Recent()
+		rows := make([][]any, len(recent))
+		for i, q := range recent {
+			var errVal any
+			if q.Error != "" {
+				errVal = q.Error
+			}
+			rows[i] = []any{
+				int64(q.ID),
+				q.StartedAt,
+				q.URI,
+				q.SQL,
+				durationMillis(q.BindLatency),
+				durationMillis(q.QueryLatency),
+				durationMillis(q.FirstBatch),
+				durationMillis(q.Total),
+				q.Batches,
+				q.Bytes,
+				q.Rows,
+				q.MinBatchRows,
+				q.MaxBatchRows,
+				durationMillis(q.NextTime),
+				durationMillis(q.ConvertTime),
+				formatConvertByType(q),
+				errVal,
+			}
+		}
+		return rows, nil
+	},
+}
+
+// duckarrowStatsTotalsFunction returns cumulative counters across all finished
+// scans as metric/value pairs. Conversion time is also split per Arrow type as
+// "convert_ms.<type>" metrics, and the sizes of received batches are summarized
+// as "batch_rows.*" and "batch_bytes.*" metrics (percentiles are bucket bounds).
+//
+// Usage in SQL:
+//
+//	SELECT * FROM duckarrow_stats_totals();
+var duckarrowStatsTotalsFunction = &rowsFunction{
+	Name: "duckarrow_stats_totals",
+	Columns: []rowsColumn{
+		{"metric", C.DUCKDB_TYPE_VARCHAR},
+		{"value", C.DUCKDB_TYPE_DOUBLE},
+	},
+	Rows: func(_ []string) ([][]any, error) {
+		t := stats.Default.Totals()
+		rows := [][]any{
+			{"queries", float64(t.Queries)},
+			{"errors", float64(t.Errors)},
+			{"batches", float64(t.Batches)},
+			{"bytes", float64(t.Bytes)},
+			{"rows", float64(t.Rows)},
+			{"bind_ms", durationMillis(t.BindTime)},
+			{"query_ms", durationMillis(t.QueryTime)},
+			{"next_ms", durationMillis(t.NextTime)},
+			{"convert_ms", durationMillis(t.ConvertTime)},
+		}
+		rows = appendHistogramMetrics(rows, "batch_rows", t.BatchRows)
+		rows = appendHistogramMetrics(rows, "batch_bytes", t.BatchBytes)
+		for _, name := range stats.SortedTypes(t.ConvertByType) {
+			rows = append(rows, []any{"convert_ms." + name, durationMillis(t.ConvertByType[name])})
+		}
+		return rows, nil
+	},
+}
+
+// appendHistogramMetrics adds the mean, median, p99 and maximum of h as
+// "<name>.<stat>" metric rows.
+func appendHistogramMetrics(rows [][]any, name string, h stats.HistogramSnapshot) [][]any {
+	return append(rows,
+		[]any{name + ".mean", h.Mean()},
+		[]any{name + ".p50", h.Quantile(0.5)},
+		[]any{name + ".p99", h.Quantile(0.99)},
+		[]any{name + ".max", h.Max},
+	)
+}
+
+// formatConvertByType renders per-type conversion time as "type=1.234ms, ...".
+func formatConvertByType(q stats.Query) string {
+	parts := make([]string, 0, len(q.ConvertByType))
+	for _, name := range stats.SortedTypes(q.ConvertByType) {
+		parts = append(parts, fmt.Sprintf("%s=%.3fms", name, durationMillis(q.ConvertByType[name])))
+	}
+	return strings.Join(parts, ", ")
+}
+
+// RegisterDuckArrowStatsFunctions registers duckarrow_stats() and duckarrow_stats_totals().
+//
+// Returns:
+//   - duckdb.STATE_OK on success, duckdb.STATE_ERROR on failure
+func RegisterDuckArrowStatsFunctions(conn duckdb.Connection) duckdb.State {
+	if state := registerRowsFunction(conn, duckarrowStatsFunction); state == duckdb.STATE_ERROR {
+		return state
+	}
+	return registerRowsFunction(conn, duckarrowStatsTotalsFunction)
+}
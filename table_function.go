@@ -8,6 +8,7 @@ package main
 
 // Callback wrappers - these call back into Go
 void duckarrow_bind_wrapper(duckdb_bind_info info);
+void duckarrow_scan_bind_wrapper(duckdb_bind_info info);
 void duckarrow_init_wrapper(duckdb_init_info info);
 void duckarrow_scan_wrapper(duckdb_function_info info, duckdb_data_chunk output);
 void duckarrow_destroy_bind_data(void *data);
@@ -18,10 +19,15 @@ import (
 	"context"
 	"duckdb"
 	"fmt"
+	"main/internal/convert"
 	"main/internal/flight"
+	"main/internal/slowlog"
+	"main/internal/stats"
+	"main/internal/tracing"
 	"runtime"
 	"runtime/cgo"
 	"sync/atomic"
+	"time"
 	"unsafe"
 
 	"github.com/apache/arrow-adbc/go/adbc"
@@ -38,9 +44,11 @@ type BindData struct {
 	URI      string        // Original URI for deferred query execution
 
 	// Deferred query construction (for projection pushdown)
-	TableName  string   // Raw table name (not full query)
+	Table      TableRef // Remote table; zero for arbitrary SQL
+	Subquery   string   // Arbitrary SQL projected as a subquery; "" if not pushed down
 	AllColumns []string // All column names from schema (for projection mapping)
 	Schema     *arrow.Schema
+	Fields     []arrow.Field // Schema fields of the scanned columns, in output order
 
 	// Query state (set in init phase with projection pushdown, or bind phase without)
 	Stmt   adbc.Statement
@@ -48,6 +56,15 @@ type BindData struct {
 
 	// Legacy field for backward compatibility
 	Query string
+
+	// Transfer and conversion metrics for duckarrow_stats() (nil in hardcoded mode)
+	Stats *stats.Recorder
+
+	// Timeline of this scan for the trace file (nil if tracing is off or not sampled)
+	Trace *tracing.Trace
+
+	// Conversion settings captured at bind, matching the declared column types
+	ConvertOptions convert.Options
 }
 
 // ScanState tracks scanning progress
@@ -55,6 +72,21 @@ type ScanState struct {
 	CurrentBatch  arrow.RecordBatch
 	BatchPosition int64
 	Done          int32
+
+	// Output vectors of the previous chunk, reused while DuckDB passes the same ones
+	Vectors []*duckVector
+}
+
+// vector returns the conversion wrapper for output column colIdx.
+func (s *ScanState) vector(colIdx int, vec duckdb.Vector) *duckVector {
+	if colIdx >= len(s.Vectors) {
+		s.Vectors = append(s.Vectors, make([]*duckVector, colIdx+1-len(s.Vectors))...)
+	}
+	if v := s.Vectors[colIdx].reuse(vec); v != nil {
+		return v
+	}
+	s.Vectors[colIdx] = newDuckVector(vec)
+	return s.Vectors[colIdx]
 }
 
 //export duckarrow_bind_wrapper
@@ -72,22 +104,68 @@ func duckarrow_bind_wrapper(info C.duckdb_bind_info) {
 	}
 
 	// Get URI and query parameters
-	uriVal := C.duckdb_bind_get_parameter(info, 0)
-	queryVal := C.duckdb_bind_get_parameter(info, 1)
-	defer C.duckdb_destroy_value(&uriVal)
-	defer C.duckdb_destroy_value(&queryVal)
-
-	uriCStr := C.duckdb_get_varchar(uriVal)
-	queryCStr := C.duckdb_get_varchar(queryVal)
-	uri := C.GoString(uriCStr)
-	query := C.GoString(queryCStr)
-	C.duckdb_free(unsafe.Pointer(uriCStr))
-	C.duckdb_free(unsafe.Pointer(queryCStr))
-
-	// Extract table name from query (format: SELECT * FROM "tablename")
-	// This is generated by the replacement scan
+	uri := bindVarcharParameter(info, 0)
+	query := bindVarcharParameter(info, 1)
+
+	// A plain SELECT * FROM "schema"."table" still gets projection pushdown
 	// If extraction fails, the query is arbitrary SQL and we skip projection pushdown
-	tableName := extractTableName(query)
+	bindRemote(info, "duckarrow_query", uri, query, extractTableRef(query))
+}
+
+// duckarrow_scan_bind_wrapper binds duckarrow_scan(uri, catalog, schema, table),
+// the target of the replacement scan. The table arrives as separate parts, so
+// no SQL has to be parsed to push projections down.
+//
+//export duckarrow_scan_bind_wrapper
+func duckarrow_scan_bind_wrapper(info C.duckdb_bind_info) {
+	runtime.LockOSThread()
+	defer runtime.UnlockOSThread()
+
+	uri := bindVarcharParameter(info, 0)
+	table := TableRef{
+		Catalog: bindVarcharParameter(info, 1),
+		Schema:  bindVarcharParameter(info, 2),
+		Name:    bindVarcharParameter(info, 3),
+	}
+	// duckarrow_scan can also be called directly, so validate like the replacement scan
+	if err := validateTableRef(table); err != nil {
+		duckdb.SetBindError(duckdb.BindInfo{Ptr: unsafe.Pointer(info)}, "%v", err)
+		return
+	}
+	bindRemote(info, "duckarrow_scan", uri, buildProjectedQuery(table, nil), table)
+}
+
+// bindVarcharParameter returns positional parameter i as a string, "" if NULL.
+func bindVarcharParameter(info C.duckdb_bind_info, i int) string {
+	val := C.duckdb_bind_get_parameter(info, C.idx_t(i))
+	defer C.duckdb_destroy_value(&val)
+	if C.duckdb_is_null_value(val) {
+		return ""
+	}
+	cStr := C.duckdb_get_varchar(val)
+	defer C.duckdb_free(unsafe.Pointer(cStr))
+	return C.GoString(cStr)
+}
+
+// bindRemote binds a scan of query on the server at uri. If table is not
+// zero, query must be SELECT * FROM table: only the schema is fetched here,
+// and init runs the query with just the columns DuckDB projects.
+func bindRemote(info C.duckdb_bind_info, function, uri, query string, table TableRef) {
+	bindStart := time.Now()
+	rec := stats.Default.Begin(uri, query)
+	var cctx C.duckdb_client_context
+	C.duckdb_table_function_get_client_context(info, &cctx)
+	rec.SetConnection(uint64(C.duckdb_client_context_get_connection_id(cctx)))
+	C.duckdb_destroy_client_context(&cctx)
+
+	label := table.String()
+	if table.IsZero() {
+		label = "query"
+	}
+	tr := tracing.Default.Begin(function, label)
+	tr.Arg("uri", uri)
+	tr.Arg("sql", query)
+	bindSpan := tr.Span("bind")
 
 	// Get credentials and settings from global config (set by duckarrow_configure)
 	_, configUsername, configPassword, configSkipVerify := GetDuckArrowConfig()
@@ -101,27 +179,59 @@ func duckarrow_bind_wrapper(info C.duckdb_bind_info) {
 	}
 
 	// Get connection from pool (or create new)
-	ctx := context.Background()
+	ctx := tracing.NewContext(context.Background(), tr)
 	connResult, err := flight.GetConnection(ctx, cfg)
 	if err != nil {
+		rec.Fail(err)
+		rec.Finish()
+		bindSpan.Fail(err)
+		bindSpan.End()
+		tr.End()
 		duckdb.SetBindError(duckdb.BindInfo{Ptr: unsafe.Pointer(info)}, "connection failed: %v", err)
 		return
 	}
 
-	// Determine which query to use for schema discovery
-	// If we have a table name, use schema-only query for efficiency
-	// Otherwise, use the original query (for arbitrary SQL)
-	var schemaQuery string
-	if tableName != "" {
-		schemaQuery = buildSchemaQuery(tableName)
-	} else {
+	// Determine the schema. Table scans and SELECT queries only plan here and
+	// run in init with DuckDB's projection pushed down: a table scan as
+	// SELECT <columns> FROM table, other SQL wrapped as a subquery. Any other
+	// SQL (or a result with duplicate column names) is executed now and its
+	// result kept.
+	var (
+		schema   *arrow.Schema
+		result   *flight.QueryResult
+		subquery string
+	)
+	queryStart := time.Now()
+	if !table.IsZero() {
+		if result, err = connResult.Client.Query(ctx, buildSchemaQuery(table)); err == nil {
+			schema = result.Reader.Schema()
+			result.Reader.Release()
+			result.Stmt.Close()
+		}
+	} else if sql, ok := projectableQuery(query); ok {
+		if schema, err = connResult.Client.Schema(ctx, sql); err == nil {
+			if uniqueColumns(schemaColumnNames(schema)) {
+				subquery = sql
+			} else {
+				// Duplicate names can't be projected by name: execute below
+				schema = nil
+			}
+		}
+	}
+	if err == nil && schema == nil && table.IsZero() {
 		// For arbitrary SQL, we need to execute it to get the schema
 		// We'll execute the full query in bind phase and store the result
-		schemaQuery = query
+		queryStart = time.Now()
+		if result, err = connResult.Client.Query(ctx, query); err == nil {
+			schema = result.Reader.Schema()
+		}
 	}
-
-	result, err := connResult.Client.Query(ctx, schemaQuery)
 	if err != nil {
+		rec.Fail(err)
+		rec.Finish()
+		bindSpan.Fail(err)
+		bindSpan.End()
+		tr.End()
 		// Clean up connection based on whether it's pooled
 		if connResult.IsPooled {
 			flight.ReleaseConnection(cfg)
@@ -131,50 +241,66 @@ func duckarrow_bind_wrapper(info C.duckdb_bind_info) {
 		duckdb.SetBindError(duckdb.BindInfo{Ptr: unsafe.Pointer(info)}, "query failed: %v", err)
 		return
 	}
+	rec.ObserveBind(time.Since(bindStart))
+	bindSpan.End()
 
 	// Get schema and column names
-	schema := result.Reader.Schema()
+	convertOptions := currentConvertOptions()
 	allColumns := make([]string, len(schema.Fields()))
 	for i, field := range schema.Fields() {
 		allColumns[i] = field.Name
 		colName := C.CString(field.Name)
-		colType := arrowTypeToDuckDB(field.Type)
+		colType := fieldToDuckDB(field, convertOptions)
 		C.duckdb_bind_add_result_column(info, colName, colType)
 		C.duckdb_destroy_logical_type(&colType)
 		C.free(unsafe.Pointer(colName))
 	}
 
-	// For table queries with projection pushdown, release schema resources
-	// For arbitrary SQL, keep the result since we can't re-execute with projection
+	// With projection pushdown the query runs in init, with the projected columns
+	// For other arbitrary SQL, keep the result since we can't re-execute with projection
 	var bindData *BindData
-	if tableName != "" {
-		// Release schema query resources - we'll re-execute with projected columns
-		result.Reader.Release()
-		result.Stmt.Close()
+	if !table.IsZero() || subquery != "" {
 		bindData = &BindData{
 			Client:     connResult.Client,
 			Config:     cfg,
 			IsPooled:   connResult.IsPooled,
 			URI:        uri,
-			TableName:  tableName,
+			Table:      table,
+			Subquery:   subquery,
 			AllColumns: allColumns,
 			Schema:     schema,
 			Query:      query,
+			Stats:      rec,
+			Trace:      tr,
+
+			ConvertOptions: convertOptions,
 			// Stmt and Reader will be set in init phase
 		}
 	} else {
 		// Arbitrary SQL - keep the result, no projection pushdown
+		// The bind query is the data query, so it also counts as the execute latency
+		rec.ObserveExecute(queryStart)
+		columnTypes := make([]string, len(schema.Fields()))
+		for i, field := range schema.Fields() {
+			columnTypes[i] = field.Type.Name()
+		}
+		rec.SetColumnTypes(columnTypes)
 		bindData = &BindData{
 			Client:     connResult.Client,
 			Config:     cfg,
 			IsPooled:   connResult.IsPooled,
 			URI:        uri,
-			TableName:  "", // Empty means no projection pushdown
+			Table:      TableRef{}, // Zero means no projection pushdown
 			AllColumns: allColumns,
 			Schema:     schema,
+			Fields:     schema.Fields(),
 			Query:      query,
 			Stmt:       result.Stmt,
 			Reader:     result.Reader,
+			Stats:      rec,
+			Trace:      tr,
+
+			ConvertOptions: convertOptions,
 		}
 	}
 	handle := cgo.NewHandle(bindData)
@@ -182,6 +308,15 @@ func duckarrow_bind_wrapper(info C.duckdb_bind_info) {
 		C.duckdb_delete_callback_t(C.duckarrow_destroy_bind_data))
 }
 
+// schemaColumnNames returns the names of schema's fields, in order.
+func schemaColumnNames(schema *arrow.Schema) []string {
+	names := make([]string, schema.NumFields())
+	for i, field := range schema.Fields() {
+		names[i] = field.Name
+	}
+	return names
+}
+
 // bindHardcodedData provides backward compatibility for no-parameter calls
 func bindHardcodedData(info C.duckdb_bind_info) {
 	colName1 := C.CString("id")
@@ -201,10 +336,11 @@ func bindHardcodedData(info C.duckdb_bind_info) {
 		C.duckdb_delete_callback_t(C.duckarrow_destroy_bind_data))
 }
 
-// arrowTypeToDuckDB converts Arrow types to DuckDB logical types
-func arrowTypeToDuckDB(t arrow.DataType) C.duckdb_logical_type {
+// arrowTypeToDuckDB converts Arrow types to DuckDB logical types. opts must be
+// the Options the scan converts values with.
+func arrowTypeToDuckDB(t arrow.DataType, opts convert.Options) C.duckdb_logical_type {
 	switch t.ID() {
-	case arrow.STRING, arrow.LARGE_STRING:
+	case arrow.STRING, arrow.LARGE_STRING, arrow.STRING_VIEW:
 		return C.duckdb_create_logical_type(C.DUCKDB_TYPE_VARCHAR)
 	case arrow.INT64:
 		return C.duckdb_create_logical_type(C.DUCKDB_TYPE_BIGINT)
@@ -229,28 +365,43 @@ func arrowTypeToDuckDB(t arrow.DataType) C.duckdb_logical_type {
 	case arrow.BOOL:
 		return C.duckdb_create_logical_type(C.DUCKDB_TYPE_BOOLEAN)
 	case arrow.TIMESTAMP:
-		return C.duckdb_create_logical_type(C.DUCKDB_TYPE_TIMESTAMP)
+		dt := t.(*arrow.TimestampType)
+		if dt.TimeZone != "" {
+			// Zoned Arrow timestamps are UTC instants; DuckDB TIMESTAMPTZ is microseconds only
+			return C.duckdb_create_logical_type(C.DUCKDB_TYPE_TIMESTAMP_TZ)
+		}
+		// Naive timestamps keep their unit so values are copied unchanged
+		switch dt.Unit {
+		case arrow.Second:
+			return C.duckdb_create_logical_type(C.DUCKDB_TYPE_TIMESTAMP_S)
+		case arrow.Millisecond:
+			return C.duckdb_create_logical_type(C.DUCKDB_TYPE_TIMESTAMP_MS)
+		case arrow.Nanosecond:
+			return C.duckdb_create_logical_type(C.DUCKDB_TYPE_TIMESTAMP_NS)
+		default:
+			return C.duckdb_create_logical_type(C.DUCKDB_TYPE_TIMESTAMP)
+		}
 	case arrow.DATE32, arrow.DATE64:
 		return C.duckdb_create_logical_type(C.DUCKDB_TYPE_DATE)
 	case arrow.TIME32, arrow.TIME64:
 		return C.duckdb_create_logical_type(C.DUCKDB_TYPE_TIME)
-	case arrow.BINARY, arrow.LARGE_BINARY:
+	case arrow.DURATION, arrow.INTERVAL_MONTHS, arrow.INTERVAL_DAY_TIME, arrow.INTERVAL_MONTH_DAY_NANO:
+		return C.duckdb_create_logical_type(C.DUCKDB_TYPE_INTERVAL)
+	case arrow.BINARY, arrow.LARGE_BINARY, arrow.BINARY_VIEW:
 		return C.duckdb_create_logical_type(C.DUCKDB_TYPE_BLOB)
 	case arrow.FIXED_SIZE_BINARY:
 		// UUIDs are typically 16-byte FixedSizeBinary, return as VARCHAR
 		return C.duckdb_create_logical_type(C.DUCKDB_TYPE_VARCHAR)
-	case arrow.DECIMAL128:
-		dt := t.(*arrow.Decimal128Type)
-		// DuckDB max precision is 38, Arrow can be up to 38
-		width := uint8(min(dt.Precision, 38))
-		scale := uint8(dt.Scale)
-		return C.duckdb_create_decimal_type(C.uint8_t(width), C.uint8_t(scale))
-	case arrow.DECIMAL256:
-		// DECIMAL256 can exceed 38 digits - truncate to DuckDB max
-		dt := t.(*arrow.Decimal256Type)
-		width := uint8(min(dt.Precision, 38))
-		scale := uint8(dt.Scale)
-		return C.duckdb_create_decimal_type(C.uint8_t(width), C.uint8_t(scale))
+	case arrow.DECIMAL128, arrow.DECIMAL256:
+		// DuckDB max precision is 38; wider decimals map per the wide_decimal setting
+		width, scale, ok := opts.Decimal(t.(arrow.DecimalType))
+		if ok {
+			return C.duckdb_create_decimal_type(C.uint8_t(width), C.uint8_t(scale))
+		}
+		if opts.WideDecimals == convert.DecimalDouble {
+			return C.duckdb_create_logical_type(C.DUCKDB_TYPE_DOUBLE)
+		}
+		return C.duckdb_create_logical_type(C.DUCKDB_TYPE_VARCHAR)
 	case arrow.STRUCT:
 		structType := t.(*arrow.StructType)
 		numFields := len(structType.Fields())
@@ -261,7 +412,7 @@ func arrowTypeToDuckDB(t arrow.DataType) C.duckdb_logical_type {
 		memberTypes := make([]C.duckdb_logical_type, numFields)
 		memberNames := make([]*C.char, numFields)
 		for i, field := range structType.Fields() {
-			memberTypes[i] = arrowTypeToDuckDB(field.Type)
+			memberTypes[i] = fieldToDuckDB(field, opts)
 			memberNames[i] = C.CString(field.Name)
 		}
 		result := C.duckdb_create_struct_type(&memberTypes[0], &memberNames[0], C.idx_t(numFields))
@@ -273,20 +424,73 @@ func arrowTypeToDuckDB(t arrow.DataType) C.duckdb_logical_type {
 		return result
 	case arrow.LIST:
 		listType := t.(*arrow.ListType)
-		childType := arrowTypeToDuckDB(listType.Elem())
+		childType := arrowTypeToDuckDB(listType.Elem(), opts)
 		result := C.duckdb_create_list_type(childType)
 		C.duckdb_destroy_logical_type(&childType)
 		return result
 	case arrow.LARGE_LIST:
 		listType := t.(*arrow.LargeListType)
-		childType := arrowTypeToDuckDB(listType.Elem())
+		childType := arrowTypeToDuckDB(listType.Elem(), opts)
+		result := C.duckdb_create_list_type(childType)
+		C.duckdb_destroy_logical_type(&childType)
+		return result
+	case arrow.LIST_VIEW, arrow.LARGE_LIST_VIEW:
+		// DuckDB list entries are (offset, length) pairs, which is already a list view
+		childType := arrowTypeToDuckDB(t.(arrow.ListLikeType).Elem(), opts)
 		result := C.duckdb_create_list_type(childType)
 		C.duckdb_destroy_logical_type(&childType)
 		return result
+	case arrow.FIXED_SIZE_LIST:
+		listType := t.(*arrow.FixedSizeListType)
+		childType := arrowTypeToDuckDB(listType.Elem(), opts)
+		var result C.duckdb_logical_type
+		if convert.NativeArray(listType) {
+			result = C.duckdb_create_array_type(childType, C.idx_t(listType.Len()))
+		} else {
+			// DuckDB rejects ARRAY sizes of 0 and above its maximum
+			result = C.duckdb_create_list_type(childType)
+		}
+		C.duckdb_destroy_logical_type(&childType)
+		return result
+	case arrow.SPARSE_UNION, arrow.DENSE_UNION:
+		unionType := t.(arrow.UnionType)
+		if !convert.NativeUnion(unionType) {
+			// Dense unions with nested members are stringified
+			return C.duckdb_create_logical_type(C.DUCKDB_TYPE_VARCHAR)
+		}
+		numMembers := len(unionType.Fields())
+		memberTypes := make([]C.duckdb_logical_type, numMembers)
+		memberNames := make([]*C.char, numMembers)
+		seen := make(map[string]bool, numMembers)
+		for i, field := range unionType.Fields() {
+			memberTypes[i] = arrowTypeToDuckDB(field.Type, opts)
+			// DuckDB member names must be unique and non-empty
+			name := field.Name
+			if name == "" || seen[name] {
+				name = fmt.Sprintf("member%d", i)
+			}
+			seen[name] = true
+			memberNames[i] = C.CString(name)
+		}
+		result := C.duckdb_create_union_type(&memberTypes[0], &memberNames[0], C.idx_t(numMembers))
+		for i := range memberTypes {
+			C.duckdb_destroy_logical_type(&memberTypes[i])
+			C.free(unsafe.Pointer(memberNames[i]))
+		}
+		return result
+	case arrow.RUN_END_ENCODED:
+		reeType := t.(*arrow.RunEndEncodedType)
+		if !convert.NativeRunEnd(reeType) {
+			// Runs of nested values are stringified
+			return C.duckdb_create_logical_type(C.DUCKDB_TYPE_VARCHAR)
+		}
+		return arrowTypeToDuckDB(reeType.Encoded(), opts)
+	case arrow.EXTENSION:
+		return fieldToDuckDB(arrow.Field{Type: t}, opts)
 	case arrow.MAP:
 		mapType := t.(*arrow.MapType)
-		keyType := arrowTypeToDuckDB(mapType.KeyType())
-		valueType := arrowTypeToDuckDB(mapType.ItemType())
+		keyType := arrowTypeToDuckDB(mapType.KeyType(), opts)
+		valueType := arrowTypeToDuckDB(mapType.ItemType(), opts)
 		result := C.duckdb_create_map_type(keyType, valueType)
 		C.duckdb_destroy_logical_type(&keyType)
 		C.duckdb_destroy_logical_type(&valueType)
@@ -297,6 +501,31 @@ func arrowTypeToDuckDB(t arrow.DataType) C.duckdb_logical_type {
 	}
 }
 
+// fieldToDuckDB converts an Arrow field's type to a DuckDB logical type,
+// mapping extension types named by the type or the field metadata through
+// the convert package's registry.
+func fieldToDuckDB(field arrow.Field, opts convert.Options) C.duckdb_logical_type {
+	ext, storage, ok := convert.ExtensionOf(field.Type, field.Metadata)
+	if !ok {
+		return arrowTypeToDuckDB(storage, opts)
+	}
+	var result C.duckdb_logical_type
+	switch ext.Target {
+	case convert.TargetUUID:
+		result = C.duckdb_create_logical_type(C.DUCKDB_TYPE_UUID)
+	case convert.TargetBoolean:
+		result = C.duckdb_create_logical_type(C.DUCKDB_TYPE_BOOLEAN)
+	default:
+		result = arrowTypeToDuckDB(storage, opts)
+	}
+	if ext.Alias != "" {
+		alias := C.CString(ext.Alias)
+		C.duckdb_logical_type_set_alias(result, alias)
+		C.free(unsafe.Pointer(alias))
+	}
+	return result
+}
+
 //export duckarrow_init_wrapper
 func duckarrow_init_wrapper(info C.duckdb_init_info) {
 	runtime.LockOSThread()
@@ -315,10 +544,10 @@ func duckarrow_init_wrapper(info C.duckdb_init_info) {
 	}
 	bindHandle := cgo.Handle(uintptr(bindPtr))
 	bindData, ok := bindHandle.Value().(*BindData)
-	if !ok || bindData.TableName == "" {
+	if !ok || (bindData.Table.IsZero() && bindData.Subquery == "") {
 		// Early return for:
 		// 1. Hardcoded data mode (invalid bindData)
-		// 2. Arbitrary SQL queries (TableName empty, but Reader already set in bind phase)
+		// 2. Arbitrary SQL that could not be wrapped (Reader already set in bind phase)
 		// In both cases, no projection pushdown is needed/possible
 		return
 	}
@@ -327,6 +556,8 @@ func duckarrow_init_wrapper(info C.duckdb_init_info) {
 	// DuckDB tells us which columns are actually needed
 	columnCount := C.duckdb_init_get_column_count(info)
 	projectedColumns := make([]string, columnCount)
+	columnTypes := make([]string, columnCount)
+	fields := make([]arrow.Field, columnCount)
 	for i := C.idx_t(0); i < columnCount; i++ {
 		colIdx := C.duckdb_init_get_column_index(info, i)
 		if int(colIdx) >= len(bindData.AllColumns) {
@@ -334,15 +565,32 @@ func duckarrow_init_wrapper(info C.duckdb_init_info) {
 			return
 		}
 		projectedColumns[i] = bindData.AllColumns[colIdx]
+		columnTypes[i] = bindData.Schema.Field(int(colIdx)).Type.Name()
+		fields[i] = bindData.Schema.Field(int(colIdx))
 	}
 
 	// Build optimized query with only the needed columns
-	query := buildProjectedQuery(bindData.TableName, projectedColumns)
+	var query string
+	if bindData.Table.IsZero() {
+		query = buildSubqueryProjection(bindData.Subquery, projectedColumns, bindData.AllColumns)
+	} else {
+		query = buildProjectedQuery(bindData.Table, projectedColumns)
+	}
+	bindData.Stats.SetSQL(query)
+	bindData.Stats.SetColumns(projectedColumns)
+	bindData.Stats.SetColumnTypes(columnTypes)
+	bindData.Fields = fields
 
 	// Execute the actual data query
-	ctx := context.Background()
+	initSpan := bindData.Trace.Span("init").Arg("columns", len(projectedColumns))
+	defer initSpan.End()
+	ctx := tracing.NewContext(context.Background(), bindData.Trace)
+	execStart := time.Now()
 	result, err := bindData.Client.Query(ctx, query)
+	bindData.Stats.ObserveExecute(execStart)
 	if err != nil {
+		bindData.Stats.Fail(err)
+		initSpan.Fail(err)
 		duckdb.SetInitError(duckdb.InitInfo{Ptr: unsafe.Pointer(info)}, "query execution failed: %v", err)
 		return
 	}
@@ -425,10 +673,18 @@ func scanArrowData(info C.duckdb_function_info, output C.duckdb_data_chunk, bind
 			state.CurrentBatch = nil
 		}
 
+		fetchSpan := bindData.Trace.Span("fetch")
+		nextStart := time.Now()
 		if !bindData.Reader.Next() {
+			bindData.Stats.ObserveNext(time.Since(nextStart), false, 0, 0)
+			fetchSpan.Arg("eof", true)
 			if err := bindData.Reader.Err(); err != nil {
+				bindData.Stats.Fail(err)
+				fetchSpan.Fail(err)
 				duckdb.SetFunctionError(duckdb.FunctionInfo{Ptr: unsafe.Pointer(info)}, "%v", err)
 			}
+			fetchSpan.End()
+			finishScan(bindData)
 			atomic.StoreInt32(&state.Done, 1)
 			C.duckdb_data_chunk_set_size(output, 0)
 			return
@@ -438,6 +694,9 @@ func scanArrowData(info C.duckdb_function_info, output C.duckdb_data_chunk, bind
 		state.CurrentBatch = bindData.Reader.RecordBatch()
 		state.CurrentBatch.Retain()
 		state.BatchPosition = 0
+		batchBytes := arrowBatchBytes(state.CurrentBatch)
+		bindData.Stats.ObserveNext(time.Since(nextStart), true, state.CurrentBatch.NumRows(), batchBytes)
+		fetchSpan.Arg("rows", state.CurrentBatch.NumRows()).Arg("bytes", batchBytes).End()
 	}
 
 	// Calculate rows to emit (max 2048 per DuckDB chunk)
@@ -449,665 +708,77 @@ func scanArrowData(info C.duckdb_function_info, output C.duckdb_data_chunk, bind
 	}
 
 	// Convert each column
-	numCols := int(state.CurrentBatch.NumCols())
+	convertSpan := bindData.Trace.Span("convert").Arg("rows", rowsToEmit)
+	defer convertSpan.End()
+	// Only the declared columns have output vectors
+	numCols := min(int(state.CurrentBatch.NumCols()), len(bindData.Fields))
 	for colIdx := 0; colIdx < numCols; colIdx++ {
 		arrowCol := state.CurrentBatch.Column(colIdx)
 		duckVec := duckdb.DataChunkGetVector(duckdb.DataChunk{Ptr: unsafe.Pointer(output)}, uint64(colIdx))
 
-		if err := convertArrowToDuckDB(arrowCol, duckVec, int(state.BatchPosition), rowsToEmit); err != nil {
+		convertStart := time.Now()
+		err := bindData.ConvertOptions.ConvertField(bindData.Fields[colIdx], arrowCol, state.vector(colIdx, duckVec), int(state.BatchPosition), rowsToEmit)
+		bindData.Stats.ObserveConvert(colIdx, time.Since(convertStart))
+		if err != nil {
+			bindData.Stats.Fail(err)
+			convertSpan.Fail(err)
 			duckdb.SetFunctionError(duckdb.FunctionInfo{Ptr: unsafe.Pointer(info)}, "convert col %d: %v", colIdx, err)
 			return
 		}
 	}
 
+	bindData.Stats.ObserveRows(rowsToEmit)
 	state.BatchPosition += int64(rowsToEmit)
 	C.duckdb_data_chunk_set_size(output, C.idx_t(rowsToEmit))
 }
 
-// convertArrowToDuckDB converts Arrow column data to DuckDB vector with proper types
-func convertArrowToDuckDB(arrowCol arrow.Array, duckVec duckdb.Vector, offset, count int) error {
-	// Ensure validity mask is writable
-	duckdb.VectorEnsureValidityWritable(duckVec)
-	validity := duckdb.VectorGetValidity(duckVec)
-
-	// Handle type-specific conversion
-	switch col := arrowCol.(type) {
-	case *array.String:
-		for i := 0; i < count; i++ {
-			srcIdx := offset + i
-			if col.IsNull(srcIdx) {
-				duckdb.ValiditySetRowInvalid(validity, uint64(i))
-				continue
-			}
-			duckdb.AssignStringToVector(duckVec, i, col.Value(srcIdx))
-		}
-
-	case *array.LargeString:
-		for i := 0; i < count; i++ {
-			srcIdx := offset + i
-			if col.IsNull(srcIdx) {
-				duckdb.ValiditySetRowInvalid(validity, uint64(i))
-				continue
-			}
-			duckdb.AssignStringToVector(duckVec, i, col.Value(srcIdx))
-		}
-
-	case *array.Int64:
-		ptr := (*C.int64_t)(duckdb.VectorGetData(duckVec))
-		data := unsafe.Slice(ptr, count)
-		for i := 0; i < count; i++ {
-			srcIdx := offset + i
-			if col.IsNull(srcIdx) {
-				duckdb.ValiditySetRowInvalid(validity, uint64(i))
-				continue
-			}
-			data[i] = C.int64_t(col.Value(srcIdx))
-		}
-
-	case *array.Int32:
-		ptr := (*C.int32_t)(duckdb.VectorGetData(duckVec))
-		data := unsafe.Slice(ptr, count)
-		for i := 0; i < count; i++ {
-			srcIdx := offset + i
-			if col.IsNull(srcIdx) {
-				duckdb.ValiditySetRowInvalid(validity, uint64(i))
-				continue
-			}
-			data[i] = C.int32_t(col.Value(srcIdx))
-		}
-
-	case *array.Int16:
-		ptr := (*C.int16_t)(duckdb.VectorGetData(duckVec))
-		data := unsafe.Slice(ptr, count)
-		for i := 0; i < count; i++ {
-			srcIdx := offset + i
-			if col.IsNull(srcIdx) {
-				duckdb.ValiditySetRowInvalid(validity, uint64(i))
-				continue
-			}
-			data[i] = C.int16_t(col.Value(srcIdx))
-		}
-
-	case *array.Int8:
-		ptr := (*C.int8_t)(duckdb.VectorGetData(duckVec))
-		data := unsafe.Slice(ptr, count)
-		for i := 0; i < count; i++ {
-			srcIdx := offset + i
-			if col.IsNull(srcIdx) {
-				duckdb.ValiditySetRowInvalid(validity, uint64(i))
-				continue
-			}
-			data[i] = C.int8_t(col.Value(srcIdx))
-		}
-
-	case *array.Uint64:
-		ptr := (*C.uint64_t)(duckdb.VectorGetData(duckVec))
-		data := unsafe.Slice(ptr, count)
-		for i := 0; i < count; i++ {
-			srcIdx := offset + i
-			if col.IsNull(srcIdx) {
-				duckdb.ValiditySetRowInvalid(validity, uint64(i))
-				continue
-			}
-			data[i] = C.uint64_t(col.Value(srcIdx))
-		}
-
-	case *array.Uint32:
-		ptr := (*C.uint32_t)(duckdb.VectorGetData(duckVec))
-		data := unsafe.Slice(ptr, count)
-		for i := 0; i < count; i++ {
-			srcIdx := offset + i
-			if col.IsNull(srcIdx) {
-				duckdb.ValiditySetRowInvalid(validity, uint64(i))
-				continue
-			}
-			data[i] = C.uint32_t(col.Value(srcIdx))
-		}
-
-	case *array.Uint16:
-		ptr := (*C.uint16_t)(duckdb.VectorGetData(duckVec))
-		data := unsafe.Slice(ptr, count)
-		for i := 0; i < count; i++ {
-			srcIdx := offset + i
-			if col.IsNull(srcIdx) {
-				duckdb.ValiditySetRowInvalid(validity, uint64(i))
-				continue
-			}
-			data[i] = C.uint16_t(col.Value(srcIdx))
-		}
-
-	case *array.Uint8:
-		ptr := (*C.uint8_t)(duckdb.VectorGetData(duckVec))
-		data := unsafe.Slice(ptr, count)
-		for i := 0; i < count; i++ {
-			srcIdx := offset + i
-			if col.IsNull(srcIdx) {
-				duckdb.ValiditySetRowInvalid(validity, uint64(i))
-				continue
-			}
-			data[i] = C.uint8_t(col.Value(srcIdx))
-		}
-
-	case *array.Float64:
-		ptr := (*C.double)(duckdb.VectorGetData(duckVec))
-		data := unsafe.Slice(ptr, count)
-		for i := 0; i < count; i++ {
-			srcIdx := offset + i
-			if col.IsNull(srcIdx) {
-				duckdb.ValiditySetRowInvalid(validity, uint64(i))
-				continue
-			}
-			data[i] = C.double(col.Value(srcIdx))
-		}
-
-	case *array.Float32:
-		ptr := (*C.float)(duckdb.VectorGetData(duckVec))
-		data := unsafe.Slice(ptr, count)
-		for i := 0; i < count; i++ {
-			srcIdx := offset + i
-			if col.IsNull(srcIdx) {
-				duckdb.ValiditySetRowInvalid(validity, uint64(i))
-				continue
-			}
-			data[i] = C.float(col.Value(srcIdx))
-		}
-
-	case *array.Boolean:
-		ptr := (*C.uint8_t)(duckdb.VectorGetData(duckVec))
-		data := unsafe.Slice(ptr, count)
-		for i := 0; i < count; i++ {
-			srcIdx := offset + i
-			if col.IsNull(srcIdx) {
-				duckdb.ValiditySetRowInvalid(validity, uint64(i))
-				continue
-			}
-			if col.Value(srcIdx) {
-				data[i] = 1
-			} else {
-				data[i] = 0
-			}
-		}
-
-	case *array.Timestamp:
-		// DuckDB TIMESTAMP is microseconds since epoch
-		unit := col.DataType().(*arrow.TimestampType).Unit
-		ptr := (*C.int64_t)(duckdb.VectorGetData(duckVec))
-		data := unsafe.Slice(ptr, count)
-		for i := 0; i < count; i++ {
-			srcIdx := offset + i
-			if col.IsNull(srcIdx) {
-				duckdb.ValiditySetRowInvalid(validity, uint64(i))
-				continue
-			}
-			ts := col.Value(srcIdx)
-			var micros int64
-			switch unit {
-			case arrow.Second:
-				micros = int64(ts) * 1_000_000
-			case arrow.Millisecond:
-				micros = int64(ts) * 1_000
-			case arrow.Microsecond:
-				micros = int64(ts)
-			case arrow.Nanosecond:
-				micros = int64(ts) / 1_000
-			}
-			data[i] = C.int64_t(micros)
-		}
-
-	case *array.Date32:
-		// DuckDB DATE is days since epoch
-		ptr := (*C.int32_t)(duckdb.VectorGetData(duckVec))
-		data := unsafe.Slice(ptr, count)
-		for i := 0; i < count; i++ {
-			srcIdx := offset + i
-			if col.IsNull(srcIdx) {
-				duckdb.ValiditySetRowInvalid(validity, uint64(i))
-				continue
-			}
-			data[i] = C.int32_t(col.Value(srcIdx))
-		}
-
-	case *array.Date64:
-		// Date64 is milliseconds since epoch, convert to days for DuckDB
-		ptr := (*C.int32_t)(duckdb.VectorGetData(duckVec))
-		data := unsafe.Slice(ptr, count)
-		for i := 0; i < count; i++ {
-			srcIdx := offset + i
-			if col.IsNull(srcIdx) {
-				duckdb.ValiditySetRowInvalid(validity, uint64(i))
-				continue
-			}
-			// Convert milliseconds to days
-			msPerDay := int64(24 * 60 * 60 * 1000)
-			data[i] = C.int32_t(col.Value(srcIdx) / arrow.Date64(msPerDay))
-		}
-
-	case *array.Time32:
-		// DuckDB TIME is microseconds since midnight
-		unit := col.DataType().(*arrow.Time32Type).Unit
-		ptr := (*C.int64_t)(duckdb.VectorGetData(duckVec))
-		data := unsafe.Slice(ptr, count)
-		for i := 0; i < count; i++ {
-			srcIdx := offset + i
-			if col.IsNull(srcIdx) {
-				duckdb.ValiditySetRowInvalid(validity, uint64(i))
-				continue
-			}
-			t := col.Value(srcIdx)
-			var micros int64
-			switch unit {
-			case arrow.Second:
-				micros = int64(t) * 1_000_000
-			case arrow.Millisecond:
-				micros = int64(t) * 1_000
-			default:
-				micros = int64(t)
-			}
-			data[i] = C.int64_t(micros)
-		}
-
-	case *array.Time64:
-		// DuckDB TIME is microseconds since midnight
-		unit := col.DataType().(*arrow.Time64Type).Unit
-		ptr := (*C.int64_t)(duckdb.VectorGetData(duckVec))
-		data := unsafe.Slice(ptr, count)
-		for i := 0; i < count; i++ {
-			srcIdx := offset + i
-			if col.IsNull(srcIdx) {
-				duckdb.ValiditySetRowInvalid(validity, uint64(i))
-				continue
-			}
-			t := col.Value(srcIdx)
-			var micros int64
-			switch unit {
-			case arrow.Microsecond:
-				micros = int64(t)
-			case arrow.Nanosecond:
-				micros = int64(t) / 1_000
-			default:
-				micros = int64(t)
-			}
-			data[i] = C.int64_t(micros)
-		}
-
-	case *array.Binary:
-		// Convert to BLOB
-		for i := 0; i < count; i++ {
-			srcIdx := offset + i
-			if col.IsNull(srcIdx) {
-				duckdb.ValiditySetRowInvalid(validity, uint64(i))
-				continue
-			}
-			duckdb.AssignBytesToVector(duckVec, i, col.Value(srcIdx))
-		}
-
-	case *array.LargeBinary:
-		// Convert to BLOB
-		for i := 0; i < count; i++ {
-			srcIdx := offset + i
-			if col.IsNull(srcIdx) {
-				duckdb.ValiditySetRowInvalid(validity, uint64(i))
-				continue
-			}
-			duckdb.AssignBytesToVector(duckVec, i, col.Value(srcIdx))
-		}
-
-	case *array.FixedSizeBinary:
-		// Convert to VARCHAR (UUIDs are typically 16-byte FixedSizeBinary)
-		for i := 0; i < count; i++ {
-			srcIdx := offset + i
-			if col.IsNull(srcIdx) {
-				duckdb.ValiditySetRowInvalid(validity, uint64(i))
-				continue
-			}
-			data := col.Value(srcIdx)
-			var val string
-			if len(data) == 16 {
-				// Format as UUID
-				val = fmt.Sprintf("%08x-%04x-%04x-%04x-%012x",
-					data[0:4], data[4:6], data[6:8], data[8:10], data[10:16])
-			} else {
-				val = fmt.Sprintf("%x", data)
-			}
-			duckdb.AssignStringToVector(duckVec, i, val)
-		}
-
-	case *array.Decimal128:
-		// DuckDB uses different internal storage based on precision:
-		// 1-4: INT16, 5-9: INT32, 10-18: INT64, 19-38: HUGEINT
-		decType := col.DataType().(*arrow.Decimal128Type)
-		precision := decType.Precision
-
-		switch {
-		case precision <= 4:
-			ptr := (*C.int16_t)(duckdb.VectorGetData(duckVec))
-			data := unsafe.Slice(ptr, count)
-			for i := 0; i < count; i++ {
-				srcIdx := offset + i
-				if col.IsNull(srcIdx) {
-					duckdb.ValiditySetRowInvalid(validity, uint64(i))
-					continue
-				}
-				val := col.Value(srcIdx)
-				data[i] = C.int16_t(val.LowBits())
-			}
-		case precision <= 9:
-			ptr := (*C.int32_t)(duckdb.VectorGetData(duckVec))
-			data := unsafe.Slice(ptr, count)
-			for i := 0; i < count; i++ {
-				srcIdx := offset + i
-				if col.IsNull(srcIdx) {
-					duckdb.ValiditySetRowInvalid(validity, uint64(i))
-					continue
-				}
-				val := col.Value(srcIdx)
-				data[i] = C.int32_t(val.LowBits())
-			}
-		case precision <= 18:
-			ptr := (*C.int64_t)(duckdb.VectorGetData(duckVec))
-			data := unsafe.Slice(ptr, count)
-			for i := 0; i < count; i++ {
-				srcIdx := offset + i
-				if col.IsNull(srcIdx) {
-					duckdb.ValiditySetRowInvalid(validity, uint64(i))
-					continue
-				}
-				val := col.Value(srcIdx)
-				data[i] = C.int64_t(val.LowBits())
-			}
-		default: // 19-38
-			ptr := (*C.duckdb_hugeint)(duckdb.VectorGetData(duckVec))
-			data := unsafe.Slice(ptr, count)
-			for i := 0; i < count; i++ {
-				srcIdx := offset + i
-				if col.IsNull(srcIdx) {
-					duckdb.ValiditySetRowInvalid(validity, uint64(i))
-					continue
-				}
-				val := col.Value(srcIdx)
-				data[i] = C.duckdb_hugeint{
-					lower: C.uint64_t(val.LowBits()),
-					upper: C.int64_t(val.HighBits()),
-				}
-			}
-		}
-
-	case *array.Decimal256:
-		// DECIMAL256 - DuckDB max precision is 38, so we truncate to low 128 bits
-		// DuckDB uses different internal storage based on precision:
-		// 1-4: INT16, 5-9: INT32, 10-18: INT64, 19-38: HUGEINT
-		decType := col.DataType().(*arrow.Decimal256Type)
-		precision := int32(min(decType.Precision, 38))
-
-		switch {
-		case precision <= 4:
-			ptr := (*C.int16_t)(duckdb.VectorGetData(duckVec))
-			data := unsafe.Slice(ptr, count)
-			for i := 0; i < count; i++ {
-				srcIdx := offset + i
-				if col.IsNull(srcIdx) {
-					duckdb.ValiditySetRowInvalid(validity, uint64(i))
-					continue
-				}
-				val := col.Value(srcIdx)
-				// Use low 64 bits of the 256-bit value
-				arr := val.Array()
-				data[i] = C.int16_t(arr[0])
-			}
-		case precision <= 9:
-			ptr := (*C.int32_t)(duckdb.VectorGetData(duckVec))
-			data := unsafe.Slice(ptr, count)
-			for i := 0; i < count; i++ {
-				srcIdx := offset + i
-				if col.IsNull(srcIdx) {
-					duckdb.ValiditySetRowInvalid(validity, uint64(i))
-					continue
-				}
-				val := col.Value(srcIdx)
-				arr := val.Array()
-				data[i] = C.int32_t(arr[0])
-			}
-		case precision <= 18:
-			ptr := (*C.int64_t)(duckdb.VectorGetData(duckVec))
-			data := unsafe.Slice(ptr, count)
-			for i := 0; i < count; i++ {
-				srcIdx := offset + i
-				if col.IsNull(srcIdx) {
-					duckdb.ValiditySetRowInvalid(validity, uint64(i))
-					continue
-				}
-				val := col.Value(srcIdx)
-				arr := val.Array()
-				data[i] = C.int64_t(arr[0])
-			}
-		default: // 19-38
-			ptr := (*C.duckdb_hugeint)(duckdb.VectorGetData(duckVec))
-			data := unsafe.Slice(ptr, count)
-			for i := 0; i < count; i++ {
-				srcIdx := offset + i
-				if col.IsNull(srcIdx) {
-					duckdb.ValiditySetRowInvalid(validity, uint64(i))
-					continue
-				}
-				val := col.Value(srcIdx)
-				arr := val.Array()
-				// arr is [4]uint64, use low 128 bits (arr[0] is lower, arr[1] is upper)
-				data[i] = C.duckdb_hugeint{
-					lower: C.uint64_t(arr[0]),
-					upper: C.int64_t(arr[1]),
-				}
-			}
-		}
-
-	case *array.Struct:
-		// Convert STRUCT by recursively converting each field
-		structType := col.DataType().(*arrow.StructType)
-		numFields := structType.NumFields()
-
-		// Set validity for struct-level nulls
-		for i := 0; i < count; i++ {
-			srcIdx := offset + i
-			if col.IsNull(srcIdx) {
-				duckdb.ValiditySetRowInvalid(validity, uint64(i))
-			}
-		}
-
-		// Convert each field recursively
-		for fieldIdx := 0; fieldIdx < numFields; fieldIdx++ {
-			childArr := col.Field(fieldIdx)
-			childVec := duckdb.StructVectorGetChild(duckVec, uint64(fieldIdx))
-			if err := convertArrowToDuckDB(childArr, childVec, offset, count); err != nil {
-				return fmt.Errorf("struct field %d: %w", fieldIdx, err)
-			}
-		}
-
-	case *array.List:
-		// Convert LIST with offset/length tracking
-		offsets := col.Offsets()
-		childArr := col.ListValues()
-		childVec := duckdb.ListVectorGetChild(duckVec)
-
-		// Get pointer to list entry data
-		listEntryPtr := (*C.duckdb_list_entry)(duckdb.VectorGetData(duckVec))
-		listEntries := unsafe.Slice(listEntryPtr, count)
-
-		// Calculate the range of child elements we need
-		// Arrow offsets are absolute positions in the child array
-		firstChildIdx := offsets[offset]
-		lastChildIdx := offsets[offset+count]
-		totalChildElements := lastChildIdx - firstChildIdx
-
-		// Reserve space in child vector
-		if totalChildElements > 0 {
-			duckdb.ListVectorReserve(duckVec, uint64(totalChildElements))
-		}
-
-		// Set up list entries with DuckDB-relative offsets
-		var duckChildOffset uint64
-		for i := 0; i < count; i++ {
-			srcIdx := offset + i
-			if col.IsNull(srcIdx) {
-				duckdb.ValiditySetRowInvalid(validity, uint64(i))
-				listEntries[i] = C.duckdb_list_entry{offset: 0, length: 0}
-				continue
-			}
-
-			start := offsets[srcIdx]
-			end := offsets[srcIdx+1]
-			length := end - start
-
-			listEntries[i] = C.duckdb_list_entry{
-				offset: C.idx_t(duckChildOffset),
-				length: C.idx_t(length),
-			}
-			duckChildOffset += uint64(length)
-		}
-
-		// Convert all child elements in one batch
-		if totalChildElements > 0 {
-			if err := convertArrowToDuckDB(childArr, childVec, int(firstChildIdx), int(totalChildElements)); err != nil {
-				return fmt.Errorf("list elements: %w", err)
-			}
-		}
-
-		// Set the total child size
-		duckdb.ListVectorSetSize(duckVec, uint64(totalChildElements))
-
-	case *array.LargeList:
-		// Convert LARGE_LIST (same as LIST but with int64 offsets)
-		offsets := col.Offsets()
-		childArr := col.ListValues()
-		childVec := duckdb.ListVectorGetChild(duckVec)
-
-		// Get pointer to list entry data
-		listEntryPtr := (*C.duckdb_list_entry)(duckdb.VectorGetData(duckVec))
-		listEntries := unsafe.Slice(listEntryPtr, count)
-
-		// Calculate the range of child elements we need
-		// Arrow offsets are absolute positions in the child array
-		firstChildIdx := offsets[offset]
-		lastChildIdx := offsets[offset+count]
-		totalChildElements := lastChildIdx - firstChildIdx
-
-		// Reserve space in child vector
-		if totalChildElements > 0 {
-			duckdb.ListVectorReserve(duckVec, uint64(totalChildElements))
-		}
-
-		// Set up list entries with DuckDB-relative offsets
-		var duckChildOffset uint64
-		for i := 0; i < count; i++ {
-			srcIdx := offset + i
-			if col.IsNull(srcIdx) {
-				duckdb.ValiditySetRowInvalid(validity, uint64(i))
-				listEntries[i] = C.duckdb_list_entry{offset: 0, length: 0}
-				continue
-			}
-
-			start := offsets[srcIdx]
-			end := offsets[srcIdx+1]
-			length := end - start
-
-			listEntries[i] = C.duckdb_list_entry{
-				offset: C.idx_t(duckChildOffset),
-				length: C.idx_t(length),
-			}
-			duckChildOffset += uint64(length)
-		}
-
-		// Convert all child elements in one batch
-		if totalChildElements > 0 {
-			if err := convertArrowToDuckDB(childArr, childVec, int(firstChildIdx), int(totalChildElements)); err != nil {
-				return fmt.Errorf("large list elements: %w", err)
-			}
-		}
-
-		// Set the total child size
-		duckdb.ListVectorSetSize(duckVec, uint64(totalChildElements))
-
-	case *array.Map:
-		// MAP is stored as LIST of STRUCT{key, value}
-		// DuckDB MAP uses same internal structure as LIST
-		offsets := col.Offsets()
-		keys := col.Keys()
-		items := col.Items()
-		childVec := duckdb.ListVectorGetChild(duckVec)
-
-		// Get pointer to list entry data
-		listEntryPtr := (*C.duckdb_list_entry)(duckdb.VectorGetData(duckVec))
-		listEntries := unsafe.Slice(listEntryPtr, count)
-
-		// Calculate the range of entries we need
-		// Arrow offsets are absolute positions in the keys/items arrays
-		firstEntryIdx := offsets[offset]
-		lastEntryIdx := offsets[offset+count]
-		totalEntries := lastEntryIdx - firstEntryIdx
-
-		// Reserve space
-		if totalEntries > 0 {
-			duckdb.ListVectorReserve(duckVec, uint64(totalEntries))
-		}
-
-		// Get child struct's key and value vectors
-		// MAP child is a STRUCT{key, value}
-		keyChildVec := duckdb.StructVectorGetChild(childVec, 0)
-		valueChildVec := duckdb.StructVectorGetChild(childVec, 1)
-
-		// Set up list entries with DuckDB-relative offsets
-		var duckChildOffset uint64
-		for i := 0; i < count; i++ {
-			srcIdx := offset + i
-			if col.IsNull(srcIdx) {
-				duckdb.ValiditySetRowInvalid(validity, uint64(i))
-				listEntries[i] = C.duckdb_list_entry{offset: 0, length: 0}
-				continue
-			}
-
-			start := offsets[srcIdx]
-			end := offsets[srcIdx+1]
-			length := end - start
-
-			listEntries[i] = C.duckdb_list_entry{
-				offset: C.idx_t(duckChildOffset),
-				length: C.idx_t(length),
-			}
-			duckChildOffset += uint64(length)
-		}
-
-		// Convert all keys and values in one batch
-		if totalEntries > 0 {
-			if err := convertArrowToDuckDB(keys, keyChildVec, int(firstEntryIdx), int(totalEntries)); err != nil {
-				return fmt.Errorf("map keys: %w", err)
-			}
-			if err := convertArrowToDuckDB(items, valueChildVec, int(firstEntryIdx), int(totalEntries)); err != nil {
-				return fmt.Errorf("map values: %w", err)
-			}
-		}
-
-		// Set the total child size
-		duckdb.ListVectorSetSize(duckVec, uint64(totalEntries))
-
-	default:
-		// Fallback: convert to string using ValueStr if available
-		for i := 0; i < count; i++ {
-			srcIdx := offset + i
-			if arrowCol.IsNull(srcIdx) {
-				duckdb.ValiditySetRowInvalid(validity, uint64(i))
-				continue
-			}
-
-			var val string
-			if stringer, ok := arrowCol.(interface{ ValueStr(int) string }); ok {
-				val = stringer.ValueStr(srcIdx)
-			} else {
-				val = fmt.Sprintf("%v", arrowCol.GetOneForMarshal(srcIdx))
-			}
+// arrowBatchBytes returns the total size of the Arrow buffers backing a record batch.
+// This approximates the bytes received from the server for duckarrow_stats().
+func arrowBatchBytes(batch arrow.RecordBatch) int64 {
+	var total int64
+	for _, col := range batch.Columns() {
+		total += arrowDataBytes(col.Data())
+	}
+	return total
+}
 
-			duckdb.AssignStringToVector(duckVec, i, val)
+// arrowDataBytes sums buffer sizes of an ArrayData and its children.
+func arrowDataBytes(data arrow.ArrayData) int64 {
+	var total int64
+	for _, buf := range data.Buffers() {
+		if buf != nil {
+			total += int64(buf.Len())
 		}
 	}
+	for _, child := range data.Children() {
+		total += arrowDataBytes(child)
+	}
+	return total
+}
 
-	return nil
+// finishScan publishes the scan's metrics once and offers it to the slow-query log.
+func finishScan(bindData *BindData) {
+	q, ok := bindData.Stats.Finish()
+	if !ok {
+		return
+	}
+	slowlog.Default.Log(slowlog.Entry{
+		Time:       q.StartedAt,
+		Kind:       slowlog.KindScan,
+		URI:        q.URI,
+		SQL:        q.SQL,
+		Columns:    q.Columns,
+		Rows:       q.Rows,
+		Bytes:      q.Bytes,
+		Batches:    q.Batches,
+		Bind:       q.BindLatency,
+		Query:      q.QueryLatency,
+		FirstBatch: q.FirstBatch,
+		Fetch:      q.NextTime,
+		Convert:    q.ConvertTime,
+		Total:      q.Total,
+		Error:      q.Error,
+	})
 }
 
 //export duckarrow_destroy_bind_data
@@ -1118,7 +789,11 @@ func duckarrow_destroy_bind_data(data unsafe.Pointer) {
 	handle := cgo.Handle(uintptr(data))
 	bindData := handle.Value().(*BindData)
 
+	// Publish metrics for scans that stopped early (e.g. LIMIT) or never ran
+	finishScan(bindData)
+
 	// Clean up query resources (reader and statement)
+	releaseSpan := bindData.Trace.Span("release")
 	if bindData.Reader != nil {
 		bindData.Reader.Release()
 	}
@@ -1134,6 +809,8 @@ func duckarrow_destroy_bind_data(data unsafe.Pointer) {
 			bindData.Client.Close()
 		}
 	}
+	releaseSpan.End()
+	bindData.Trace.End()
 
 	handle.Delete()
 }
@@ -1154,27 +831,44 @@ func duckarrow_destroy_init_data(data unsafe.Pointer) {
 	handle.Delete()
 }
 
-// RegisterDuckArrowQuery registers the duckarrow_query table function
+// RegisterDuckArrowQuery registers the duckarrow_query(uri, query) and
+// duckarrow_scan(uri, catalog, schema, table) table functions
 func RegisterDuckArrowQuery(conn duckdb.Connection) duckdb.State {
+	if state := registerScanFunction(conn, "duckarrow_query", 2, nil,
+		C.duckdb_table_function_bind_t(C.duckarrow_bind_wrapper)); state == duckdb.STATE_ERROR {
+		return state
+	}
+	return registerScanFunction(conn, "duckarrow_scan", 4, nil,
+		C.duckdb_table_function_bind_t(C.duckarrow_scan_bind_wrapper))
+}
+
+// registerScanFunction registers a remote scan with params positional and
+// the named VARCHAR parameters, and the given bind callback; init and scan
+// are shared.
+func registerScanFunction(conn duckdb.Connection, funcName string, params int, named []string, bind C.duckdb_table_function_bind_t) duckdb.State {
 	tableFunc := C.duckdb_create_table_function()
 	defer C.duckdb_destroy_table_function(&tableFunc)
 
-	name := C.CString("duckarrow_query")
+	name := C.CString(funcName)
 	defer C.free(unsafe.Pointer(name))
 	C.duckdb_table_function_set_name(tableFunc, name)
 
-	// Add two VARCHAR parameters: uri and query
 	varcharType := C.duckdb_create_logical_type(C.DUCKDB_TYPE_VARCHAR)
-	C.duckdb_table_function_add_parameter(tableFunc, varcharType)
-	C.duckdb_table_function_add_parameter(tableFunc, varcharType)
+	for i := 0; i < params; i++ {
+		C.duckdb_table_function_add_parameter(tableFunc, varcharType)
+	}
+	for _, param := range named {
+		cName := C.CString(param)
+		C.duckdb_table_function_add_named_parameter(tableFunc, cName, varcharType)
+		C.free(unsafe.Pointer(cName))
+	}
 	C.duckdb_destroy_logical_type(&varcharType)
 
 	// Enable projection pushdown - allows DuckDB to tell us which columns are needed
 	C.duckdb_table_function_supports_projection_pushdown(tableFunc, true)
 
 	// Set callbacks
-	C.duckdb_table_function_set_bind(tableFunc,
-		C.duckdb_table_function_bind_t(C.duckarrow_bind_wrapper))
+	C.duckdb_table_function_set_bind(tableFunc, bind)
 	C.duckdb_table_function_set_init(tableFunc,
 		C.duckdb_table_function_init_t(C.duckarrow_init_wrapper))
 	C.duckdb_table_function_set_function(tableFunc,
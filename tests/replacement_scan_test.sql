@@ -90,3 +90,39 @@ SELECT * FROM duckarrow."test--malicious" LIMIT 1;
 -- Test 20: SQL injection - block comment should be rejected (expect error)
 SELECT '=== Test 20: SQL injection - block comment ===' as test;
 SELECT * FROM duckarrow."test/*evil*/" LIMIT 1;
+
+-- Test 21: Schema-qualified name (projection pushdown still applies)
+SELECT '=== Test 21: Schema-qualified name ===' as test;
+SELECT duckarrow_configure('grpc+tls://localhost:31337', 'gizmosql_user', 'gizmosql_password', true);
+SELECT id, name FROM duckarrow."main.Order" LIMIT 3;
+
+-- Test 22: Catalog-qualified name
+SELECT '=== Test 22: Catalog-qualified name ===' as test;
+SELECT COUNT(*) as count FROM duckarrow."memory.main.Order";
+
+-- Test 23: Too many name parts should be rejected (expect error)
+SELECT '=== Test 23: Too many name parts ===' as test;
+SELECT * FROM duckarrow."a.b.c.d" LIMIT 1;
+
+-- Test 24: duckarrow_scan called directly with a table descriptor
+SELECT '=== Test 24: duckarrow_scan descriptor ===' as test;
+SELECT id, name FROM duckarrow_scan('grpc+tls://localhost:31337', '', 'main', 'Order') LIMIT 3;
+
+-- Test 25: Projection pushdown into arbitrary SQL (wrapped as a subquery)
+SELECT '=== Test 25: duckarrow_query subquery projection ===' as test;
+SELECT name FROM duckarrow_query(
+    'grpc+tls://localhost:31337',
+    'SELECT id, name, status FROM "Order" WHERE status = ''COMPLETED'''
+) LIMIT 3;
+
+-- Test 26: Aggregate pushdown (the server returns one row per status)
+SELECT '=== Test 26: duckarrow_aggregate ===' as test;
+SELECT * FROM duckarrow_aggregate('Order', 'count(*), max(id)', group_by := 'status');
+
+-- Test 27: Unsupported aggregate should be rejected (expect error)
+SELECT '=== Test 27: Unsupported aggregate ===' as test;
+SELECT * FROM duckarrow_aggregate('Order', 'median(id)');
+
+-- Test 28: Duplicate column names in arbitrary SQL are executed as given, not projected
+SELECT '=== Test 28: duckarrow_query with duplicate column names ===' as test;
+SELECT b FROM duckarrow_query('grpc+tls://localhost:31337', 'SELECT 1 AS a, 2 AS a, 3 AS b');